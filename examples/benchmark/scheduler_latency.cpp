@@ -0,0 +1,277 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Measures the latency distribution of schedulers under an open-loop load:
+//
+//   example.benchmark.scheduler_latency [--rate OPS_PER_SEC] [--duration SECONDS]
+//                                       [--threads N] [--filter SUBSTRING]
+//
+// A driver thread submits `schedule(sch) | then(...)` at Poisson-distributed arrival times.
+// Latency is measured from the *intended* arrival time to the start of the task, so a slow
+// scheduler that delays the driver does not hide its own tail (coordinated omission).
+//
+// Two distributions are reported per scheduler:
+//  - "start":  all tasks, i.e. enqueue-to-start latency under the offered load.
+//  - "wakeup": the tasks submitted while the scheduler had no other task in flight, i.e. the
+//              latency of waking up an idle worker.
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <latch>
+#include <random>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <exec/single_thread_context.hpp>
+#include <exec/static_thread_pool.hpp>
+#include <exec/timed_thread_scheduler.hpp>
+#include <stdexec/execution.hpp>
+
+#if __has_include(<linux/io_uring.h>) && __has_include(<linux/version.h>)
+#  include <linux/version.h>
+#  if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 4, 0)
+#    define STDEXEC_LATENCY_WITH_IO_URING 1
+#    include <exec/linux/io_uring_context.hpp>
+#  endif
+#endif
+
+namespace {
+  using clock_type = std::chrono::steady_clock;
+
+  // A log-linear histogram in the style of HdrHistogram. Values below 2048 are recorded
+  // exactly; larger values are recorded with 10 bits of precision (a relative error below
+  // 0.1%). Percentiles report the highest value that is equivalent to the recorded one.
+  class hdr_histogram {
+   public:
+    static constexpr unsigned sub_bucket_bits = 11;
+    static constexpr std::uint64_t sub_bucket_count = 1ull << sub_bucket_bits;
+    static constexpr std::uint64_t half_count = sub_bucket_count / 2;
+
+    hdr_histogram()
+      : counts_(sub_bucket_count + (64 - sub_bucket_bits) * half_count) {
+    }
+
+    void record(std::uint64_t value) noexcept {
+      ++counts_[index_of(value)];
+      ++total_;
+      max_ = std::max(max_, value);
+    }
+
+    [[nodiscard]]
+    auto count() const noexcept -> std::uint64_t {
+      return total_;
+    }
+
+    [[nodiscard]]
+    auto max() const noexcept -> std::uint64_t {
+      return max_;
+    }
+
+    [[nodiscard]]
+    auto percentile(double p) const noexcept -> std::uint64_t {
+      if (total_ == 0) {
+        return 0;
+      }
+      const auto rank = std::max<std::uint64_t>(
+        1, static_cast<std::uint64_t>(std::ceil(p / 100.0 * static_cast<double>(total_))));
+      std::uint64_t seen = 0;
+      for (std::size_t i = 0; i < counts_.size(); ++i) {
+        seen += counts_[i];
+        if (seen >= rank) {
+          return std::min(highest_equivalent(i), max_);
+        }
+      }
+      return max_;
+    }
+
+   private:
+    static auto index_of(std::uint64_t value) noexcept -> std::size_t {
+      if (value < sub_bucket_count) {
+        return static_cast<std::size_t>(value);
+      }
+      const auto shift = static_cast<unsigned>(std::bit_width(value)) - sub_bucket_bits;
+      const std::uint64_t top = value >> shift; // in [half_count, sub_bucket_count)
+      return static_cast<std::size_t>(
+        sub_bucket_count + (shift - 1) * half_count + (top - half_count));
+    }
+
+    static auto highest_equivalent(std::size_t index) noexcept -> std::uint64_t {
+      if (index < sub_bucket_count) {
+        return index;
+      }
+      const std::uint64_t k = index - sub_bucket_count;
+      const std::uint64_t shift = k / half_count + 1;
+      const std::uint64_t top = k % half_count + half_count;
+      return (top << shift) + ((1ull << shift) - 1);
+    }
+
+    std::vector<std::uint64_t> counts_;
+    std::uint64_t total_ = 0;
+    std::uint64_t max_ = 0;
+  };
+
+  struct options {
+    double rate = 50'000.0;
+    double duration = 2.0;
+    std::uint32_t threads = std::max(std::thread::hardware_concurrency(), 1u);
+    std::string filter;
+  };
+
+  struct sample {
+    clock_type::time_point arrival;
+    clock_type::time_point start;
+    bool idle;
+  };
+
+  // Sleeps until shortly before `deadline` and spins for the rest, so that arrivals are precise.
+  void wait_until(clock_type::time_point deadline) {
+    constexpr auto spin_window = std::chrono::microseconds(50);
+    if (clock_type::now() + spin_window < deadline) {
+      std::this_thread::sleep_until(deadline - spin_window);
+    }
+    while (clock_type::now() < deadline) {
+    }
+  }
+
+  template <class Scheduler>
+  auto measure(Scheduler sched, const options& opts) -> std::vector<sample> {
+    const auto num_tasks = static_cast<std::size_t>(opts.rate * opts.duration);
+    std::vector<sample> samples(num_tasks);
+    std::atomic<std::size_t> in_flight{0};
+    std::latch finished{static_cast<std::ptrdiff_t>(num_tasks)};
+
+    std::mt19937_64 rng{42};
+    std::exponential_distribution<double> inter_arrival{opts.rate};
+    auto arrival = clock_type::now();
+    for (std::size_t i = 0; i < num_tasks; ++i) {
+      arrival += std::chrono::duration_cast<clock_type::duration>(
+        std::chrono::duration<double>(inter_arrival(rng)));
+      wait_until(arrival);
+      samples[i].arrival = arrival;
+      samples[i].idle = in_flight.fetch_add(1, std::memory_order_relaxed) == 0;
+      stdexec::start_detached(stdexec::schedule(sched) | stdexec::then([&, i]() noexcept {
+                                samples[i].start = clock_type::now();
+                                in_flight.fetch_sub(1, std::memory_order_relaxed);
+                                finished.count_down();
+                              }));
+    }
+    finished.wait();
+    return samples;
+  }
+
+  void print_header() {
+    std::cout << std::left << std::setw(24) << "scheduler" << std::setw(8) << "kind" << std::right
+              << std::setw(10) << "count" << std::setw(10) << "p50" << std::setw(10) << "p90"
+              << std::setw(10) << "p99" << std::setw(10) << "p99.9" << std::setw(10) << "p99.99"
+              << std::setw(10) << "max" << "   (latencies in us)\n";
+  }
+
+  void print_row(std::string_view scheduler, std::string_view kind, const hdr_histogram& h) {
+    auto us = [](std::uint64_t ns) {
+      return static_cast<double>(ns) / 1000.0;
+    };
+    std::cout << std::left << std::setw(24) << scheduler << std::setw(8) << kind << std::right
+              << std::setw(10) << h.count() << std::fixed << std::setprecision(1);
+    for (double p: {50.0, 90.0, 99.0, 99.9, 99.99}) {
+      std::cout << std::setw(10) << us(h.percentile(p));
+    }
+    std::cout << std::setw(10) << us(h.max()) << std::endl;
+  }
+
+  template <class Scheduler>
+  void run(std::string_view name, Scheduler sched, const options& opts) {
+    if (name.find(opts.filter) == std::string_view::npos) {
+      return;
+    }
+    hdr_histogram start;
+    hdr_histogram wakeup;
+    for (const sample& s: measure(sched, opts)) {
+      const std::chrono::nanoseconds latency = s.start - s.arrival;
+      const auto ns = static_cast<std::uint64_t>(std::max<std::int64_t>(latency.count(), 0));
+      start.record(ns);
+      if (s.idle) {
+        wakeup.record(ns);
+      }
+    }
+    print_row(name, "start", start);
+    print_row(name, "wakeup", wakeup);
+  }
+
+  auto parse_options(int argc, char** argv) -> options {
+    options opts;
+    for (int i = 1; i + 1 < argc; i += 2) {
+      std::string_view arg = argv[i];
+      if (arg == "--rate") {
+        opts.rate = std::strtod(argv[i + 1], nullptr);
+      } else if (arg == "--duration") {
+        opts.duration = std::strtod(argv[i + 1], nullptr);
+      } else if (arg == "--threads") {
+        opts.threads = static_cast<std::uint32_t>(std::strtoul(argv[i + 1], nullptr, 10));
+      } else if (arg == "--filter") {
+        opts.filter = argv[i + 1];
+      } else {
+        std::cerr << "Usage: example.benchmark.scheduler_latency [--rate OPS_PER_SEC] "
+                     "[--duration SECONDS] [--threads N] [--filter SUBSTRING]"
+                  << std::endl;
+        std::exit(-1);
+      }
+    }
+    return opts;
+  }
+} // namespace
+
+int main(int argc, char** argv) {
+  const options opts = parse_options(argc, argv);
+  std::cout << "Offered load: " << opts.rate << " ops/s for " << opts.duration << " s\n";
+  print_header();
+  {
+    exec::static_thread_pool pool{opts.threads};
+    run("static_thread_pool", pool.get_scheduler(), opts);
+  }
+  {
+    stdexec::run_loop loop;
+    std::thread worker{[&] { loop.run(); }};
+    run("run_loop", loop.get_scheduler(), opts);
+    loop.finish();
+    worker.join();
+  }
+  {
+    exec::single_thread_context context;
+    run("single_thread_context", context.get_scheduler(), opts);
+  }
+  {
+    exec::timed_thread_context context;
+    run("timed_thread_scheduler", context.get_scheduler(), opts);
+  }
+#if STDEXEC_LATENCY_WITH_IO_URING
+  {
+    exec::io_uring_context context;
+    std::thread worker{[&] { context.run_until_stopped(); }};
+    run("io_uring_context", context.get_scheduler(), opts);
+    context.request_stop();
+    worker.join();
+  }
+#endif
+}
@@ -0,0 +1,543 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// A suite of scheduler benchmarks that covers recursive fork-join (fib, nqueens, an unbalanced
+// tree search), a parallel loop with irregular costs, a bounded producer-consumer pipeline and a
+// timer-heavy workload. Every workload runs on every scheduler that was compiled in, and the
+// results are written to stdout as a JSON array:
+//
+//   example.benchmark.scheduler_suite [--threads N] [--runs N] [--filter SUBSTRING]
+//
+// Every workload computes a checksum that is compared with a serial computation, so that a
+// scheduler that loses or duplicates work is reported as invalid instead of fast.
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <numeric>
+#include <semaphore>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <exec/static_thread_pool.hpp>
+#include <exec/system_context.hpp>
+#include <exec/timed_thread_scheduler.hpp>
+#include <stdexec/execution.hpp>
+
+#include "./static_thread_pool_old.hpp"
+
+#if STDEXEC_SUITE_WITH_TBB
+#  include <execpools/tbb/tbb_thread_pool.hpp>
+#endif
+#if STDEXEC_SUITE_WITH_TASKFLOW
+#  include <execpools/taskflow/taskflow_thread_pool.hpp>
+#endif
+#if STDEXEC_SUITE_WITH_ASIO
+#  include <execpools/asio/asio_thread_pool.hpp>
+#endif
+
+namespace {
+  struct options {
+    std::uint32_t threads = std::max(std::thread::hardware_concurrency(), 1u);
+    std::size_t runs = 5;
+    std::string filter;
+  };
+
+  auto splitmix64(std::uint64_t x) noexcept -> std::uint64_t {
+    x += 0x9e3779b97f4a7c15;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111eb;
+    return x ^ (x >> 31);
+  }
+
+  // Runs tasks on `sched` that can spawn more tasks into the same group. `wait` returns once
+  // all the tasks have finished. Tasks are started with `start_detached`, so every task is an
+  // independent enqueue on the scheduler, which is what the recursive workloads measure.
+  template <class Scheduler>
+  class task_group {
+   public:
+    explicit task_group(Scheduler sched)
+      : sched_(std::move(sched)) {
+    }
+
+    template <class Fun>
+    void spawn(Fun fun) {
+      spawn_sender(stdexec::schedule(sched_) | stdexec::then(std::move(fun)));
+    }
+
+    template <class Sender>
+    void spawn_sender(Sender&& sndr) {
+      pending_.fetch_add(1, std::memory_order_relaxed);
+      stdexec::start_detached(static_cast<Sender&&>(sndr) | stdexec::then([this] { done(); }));
+    }
+
+    //! Must be called exactly once, after the last task has been spawned from outside the group.
+    void wait() {
+      done();
+      std::unique_lock lock{mutex_};
+      cv_.wait(lock, [this] { return finished_; });
+    }
+
+   private:
+    void done() {
+      if (pending_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        std::lock_guard lock{mutex_};
+        finished_ = true;
+        cv_.notify_all();
+      }
+    }
+
+    Scheduler sched_;
+    //! The tasks that have not finished, plus one until `wait` is called.
+    std::atomic<std::size_t> pending_{1};
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool finished_{false};
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////////
+  // fib: binary recursion with a serial cutoff. One child is spawned, the other runs inline.
+  struct fib {
+    static constexpr std::string_view name = "fib";
+    static constexpr long n = 38;
+    static constexpr long cutoff = 18;
+
+    static auto serial(long k) -> std::uint64_t {
+      return k < 2 ? static_cast<std::uint64_t>(k) : serial(k - 1) + serial(k - 2);
+    }
+
+    static auto expected() -> std::uint64_t {
+      return serial(n);
+    }
+
+    template <class Scheduler>
+    static auto run(Scheduler sched, const options&) -> std::uint64_t {
+      std::atomic<std::uint64_t> sum{0};
+      task_group<Scheduler> group{sched};
+      std::function<void(long)> visit = [&](long k) {
+        while (k >= cutoff) {
+          group.spawn([&visit, k] { visit(k - 1); });
+          k -= 2;
+        }
+        sum.fetch_add(serial(k), std::memory_order_relaxed);
+      };
+      group.spawn([&] { visit(n); });
+      group.wait();
+      return sum.load();
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////////
+  // nqueens: a task per valid placement in the first rows, then serial backtracking.
+  struct nqueens {
+    static constexpr std::string_view name = "nqueens";
+    static constexpr int n = 12;
+    static constexpr int spawn_depth = 3;
+
+    using board = std::array<int, n>;
+
+    static auto safe(const board& b, int row, int col) noexcept -> bool {
+      for (int r = 0; r < row; ++r) {
+        if (b[r] == col || std::abs(b[r] - col) == row - r) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    static auto serial(board& b, int row) -> std::uint64_t {
+      if (row == n) {
+        return 1;
+      }
+      std::uint64_t count = 0;
+      for (int col = 0; col < n; ++col) {
+        if (safe(b, row, col)) {
+          b[row] = col;
+          count += serial(b, row + 1);
+        }
+      }
+      return count;
+    }
+
+    static auto expected() -> std::uint64_t {
+      board b{};
+      return serial(b, 0);
+    }
+
+    template <class Scheduler>
+    static auto run(Scheduler sched, const options&) -> std::uint64_t {
+      std::atomic<std::uint64_t> solutions{0};
+      task_group<Scheduler> group{sched};
+      std::function<void(board, int)> visit = [&](board b, int row) {
+        if (row == spawn_depth) {
+          solutions.fetch_add(serial(b, row), std::memory_order_relaxed);
+          return;
+        }
+        for (int col = 0; col < n; ++col) {
+          if (safe(b, row, col)) {
+            b[row] = col;
+            group.spawn([&visit, b, row] { visit(b, row + 1); });
+          }
+        }
+      };
+      group.spawn([&] { visit(board{}, 0); });
+      group.wait();
+      return solutions.load();
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////////
+  // uts: an unbalanced tree search over a binomial tree (as in the T3 family of the UTS
+  // benchmark). The root has `root_children` children, and every other node has `m` children
+  // with probability `q`. The shape is a deterministic function of the node ids. A task explores
+  // its subtree depth-first and hands off half of its stack every `chunk` nodes.
+  struct uts {
+    static constexpr std::string_view name = "uts";
+    static constexpr std::uint64_t root_children = 20000;
+    static constexpr std::uint64_t m = 5;
+    static constexpr double q = 0.1995;
+    static constexpr std::size_t chunk = 256;
+
+    static auto num_children(std::uint64_t id, bool root) noexcept -> std::uint64_t {
+      if (root) {
+        return root_children;
+      }
+      const double u = static_cast<double>(splitmix64(id) >> 11) * 0x1.0p-53;
+      return u < q ? m : 0;
+    }
+
+    static auto child(std::uint64_t id, std::uint64_t i) noexcept -> std::uint64_t {
+      return splitmix64(id * 31 + i + 1);
+    }
+
+    static auto expected() -> std::uint64_t {
+      std::uint64_t count = 0;
+      std::vector<std::pair<std::uint64_t, bool>> stack{{0, true}};
+      while (!stack.empty()) {
+        auto [id, root] = stack.back();
+        stack.pop_back();
+        ++count;
+        for (std::uint64_t i = 0, c = num_children(id, root); i < c; ++i) {
+          stack.emplace_back(child(id, i), false);
+        }
+      }
+      return count;
+    }
+
+    template <class Scheduler>
+    static auto run(Scheduler sched, const options&) -> std::uint64_t {
+      std::atomic<std::uint64_t> nodes{0};
+      task_group<Scheduler> group{sched};
+      using stack_t = std::vector<std::pair<std::uint64_t, bool>>;
+      std::function<void(stack_t)> visit = [&](stack_t stack) {
+        std::uint64_t count = 0;
+        while (!stack.empty()) {
+          auto [id, root] = stack.back();
+          stack.pop_back();
+          ++count;
+          for (std::uint64_t i = 0, c = num_children(id, root); i < c; ++i) {
+            stack.emplace_back(child(id, i), false);
+          }
+          if (count % chunk == 0 && stack.size() > 1) {
+            auto half = static_cast<std::ptrdiff_t>(stack.size() / 2);
+            stack_t stolen(stack.begin(), stack.begin() + half);
+            stack.erase(stack.begin(), stack.begin() + half);
+            group.spawn([&visit, stolen = std::move(stolen)]() mutable {
+              visit(std::move(stolen));
+            });
+          }
+        }
+        nodes.fetch_add(count, std::memory_order_relaxed);
+      };
+      group.spawn([&] { visit(stack_t{{0, true}}); });
+      group.wait();
+      return nodes.load();
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////////
+  // irregular_loop: a `bulk` whose iterations have heavy-tailed costs. Most iterations are
+  // cheap, a few are up to 1000 times more expensive, and they are clustered by index.
+  struct irregular_loop {
+    static constexpr std::string_view name = "irregular_loop";
+    static constexpr std::uint32_t size = 1 << 14;
+
+    static auto cost(std::uint32_t i) noexcept -> std::uint32_t {
+      const std::uint32_t cluster = i / 512;
+      const auto h = splitmix64(cluster);
+      return 16u << (h % 7 == 0 ? 10 : (h % 3));
+    }
+
+    static auto work(std::uint32_t i) noexcept -> std::uint64_t {
+      std::uint64_t x = i;
+      for (std::uint32_t k = 0, c = cost(i); k < c; ++k) {
+        x = splitmix64(x);
+      }
+      return x & 0xffff;
+    }
+
+    static auto expected() -> std::uint64_t {
+      std::uint64_t sum = 0;
+      for (std::uint32_t i = 0; i < size; ++i) {
+        sum += work(i);
+      }
+      return sum;
+    }
+
+    template <class Scheduler>
+    static auto run(Scheduler sched, const options&) -> std::uint64_t {
+      std::atomic<std::uint64_t> sum{0};
+      stdexec::sync_wait(
+        stdexec::schedule(sched) | stdexec::bulk(size, [&](std::uint32_t i) {
+          sum.fetch_add(work(i), std::memory_order_relaxed);
+        }));
+      return sum.load();
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////////
+  // pipeline: a producer pushes items through `stages` stages. Every stage is a separate task on
+  // the scheduler, and at most `window` items are in flight, like a bounded queue.
+  struct pipeline {
+    static constexpr std::string_view name = "pipeline";
+    static constexpr std::uint64_t items = 100'000;
+    static constexpr int stages = 4;
+    static constexpr std::ptrdiff_t window = 256;
+
+    static auto stage(std::uint64_t value, int s) noexcept -> std::uint64_t {
+      return splitmix64(value + static_cast<std::uint64_t>(s));
+    }
+
+    static auto expected() -> std::uint64_t {
+      std::uint64_t sum = 0;
+      for (std::uint64_t i = 0; i < items; ++i) {
+        std::uint64_t value = i;
+        for (int s = 0; s < stages; ++s) {
+          value = stage(value, s);
+        }
+        sum += value & 0xffff;
+      }
+      return sum;
+    }
+
+    template <class Scheduler>
+    static auto run(Scheduler sched, const options&) -> std::uint64_t {
+      std::atomic<std::uint64_t> sum{0};
+      std::counting_semaphore<window> slots{window};
+      task_group<Scheduler> group{sched};
+      std::function<void(std::uint64_t, int)> hop = [&](std::uint64_t value, int s) {
+        value = stage(value, s);
+        if (s + 1 < stages) {
+          group.spawn([&hop, value, s] { hop(value, s + 1); });
+        } else {
+          sum.fetch_add(value & 0xffff, std::memory_order_relaxed);
+          slots.release();
+        }
+      };
+      for (std::uint64_t i = 0; i < items; ++i) {
+        slots.acquire();
+        group.spawn([&hop, i] { hop(i, 0); });
+      }
+      group.wait();
+      return sum.load();
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////////
+  // timers: many short timers on a `timed_thread_context` whose continuations run on the
+  // scheduler. This measures how well the scheduler absorbs bursts of remote enqueues.
+  struct timers {
+    static constexpr std::string_view name = "timers";
+    static constexpr std::uint64_t count = 20'000;
+
+    static auto delay(std::uint64_t i) noexcept -> std::chrono::microseconds {
+      return std::chrono::microseconds(splitmix64(i) % 2000);
+    }
+
+    static auto expected() -> std::uint64_t {
+      return count * (count - 1) / 2;
+    }
+
+    template <class Scheduler>
+    static auto run(Scheduler sched, const options&) -> std::uint64_t {
+      exec::timed_thread_context context;
+      std::atomic<std::uint64_t> sum{0};
+      task_group<Scheduler> group{sched};
+      for (std::uint64_t i = 0; i < count; ++i) {
+        group.spawn_sender(
+          exec::schedule_after(context.get_scheduler(), delay(i)) | stdexec::continues_on(sched)
+          | stdexec::then([&sum, i] { sum.fetch_add(i, std::memory_order_relaxed); }));
+      }
+      group.wait();
+      return sum.load();
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////////
+  struct measurement {
+    double mean_ms;
+    double median_ms;
+    double min_ms;
+    double max_ms;
+    double stddev_ms;
+  };
+
+  auto summarize(std::vector<double> times) -> measurement {
+    std::sort(times.begin(), times.end());
+    const auto n = static_cast<double>(times.size());
+    const double mean = std::accumulate(times.begin(), times.end(), 0.0) / n;
+    double variance = 0.0;
+    for (double t: times) {
+      variance += (t - mean) * (t - mean);
+    }
+    const std::size_t mid = times.size() / 2;
+    const double median = times.size() % 2 ? times[mid] : (times[mid - 1] + times[mid]) / 2;
+    return {mean, median, times.front(), times.back(), std::sqrt(variance / n)};
+  }
+
+  class json_report {
+   public:
+    json_report() {
+      std::cout << "[";
+    }
+
+    ~json_report() {
+      std::cout << "\n]" << std::endl;
+    }
+
+    void add(
+      std::string_view benchmark,
+      std::string_view scheduler,
+      const options& opts,
+      const measurement& m,
+      bool valid) {
+      std::cout << (first_ ? "\n" : ",\n") << "  {\"benchmark\": \"" << benchmark
+                << "\", \"scheduler\": \"" << scheduler << "\", \"threads\": " << opts.threads
+                << ", \"runs\": " << opts.runs << ", \"mean_ms\": " << m.mean_ms
+                << ", \"median_ms\": " << m.median_ms << ", \"min_ms\": " << m.min_ms
+                << ", \"max_ms\": " << m.max_ms << ", \"stddev_ms\": " << m.stddev_ms
+                << ", \"valid\": " << (valid ? "true" : "false") << "}";
+      first_ = false;
+    }
+
+   private:
+    bool first_ = true;
+  };
+
+  template <class Workload, class Scheduler>
+  void run_workload(
+    json_report& report,
+    std::string_view scheduler_name,
+    Scheduler sched,
+    const options& opts) {
+    std::string label = std::string(Workload::name) + "/" + std::string(scheduler_name);
+    if (label.find(opts.filter) == std::string::npos) {
+      return;
+    }
+    const std::uint64_t expected = Workload::expected();
+    bool valid = Workload::run(sched, opts) == expected; // warmup
+    std::vector<double> times;
+    for (std::size_t i = 0; i < opts.runs; ++i) {
+      auto start = std::chrono::steady_clock::now();
+      valid &= Workload::run(sched, opts) == expected;
+      auto end = std::chrono::steady_clock::now();
+      times.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+    }
+    report.add(Workload::name, scheduler_name, opts, summarize(std::move(times)), valid);
+  }
+
+  template <class Scheduler>
+  void run_all(
+    json_report& report,
+    std::string_view scheduler_name,
+    Scheduler sched,
+    const options& opts) {
+    run_workload<fib>(report, scheduler_name, sched, opts);
+    run_workload<nqueens>(report, scheduler_name, sched, opts);
+    run_workload<uts>(report, scheduler_name, sched, opts);
+    // The old pool's customization of `bulk` does not compile with current stdexec.
+    if constexpr (!std::same_as<Scheduler, exec_old::static_thread_pool::scheduler>) {
+      run_workload<irregular_loop>(report, scheduler_name, sched, opts);
+    }
+    run_workload<pipeline>(report, scheduler_name, sched, opts);
+    run_workload<timers>(report, scheduler_name, sched, opts);
+  }
+
+  auto parse_options(int argc, char** argv) -> options {
+    options opts;
+    for (int i = 1; i + 1 < argc; i += 2) {
+      std::string_view arg = argv[i];
+      if (arg == "--threads") {
+        opts.threads = static_cast<std::uint32_t>(std::strtoul(argv[i + 1], nullptr, 10));
+      } else if (arg == "--runs") {
+        opts.runs = std::strtoul(argv[i + 1], nullptr, 10);
+      } else if (arg == "--filter") {
+        opts.filter = argv[i + 1];
+      } else {
+        std::cerr << "Usage: example.benchmark.scheduler_suite [--threads N] [--runs N] "
+                     "[--filter SUBSTRING]"
+                  << std::endl;
+        std::exit(-1);
+      }
+    }
+    opts.runs = std::max<std::size_t>(opts.runs, 1);
+    return opts;
+  }
+} // namespace
+
+int main(int argc, char** argv) {
+  const options opts = parse_options(argc, argv);
+  json_report report;
+  {
+    exec::static_thread_pool pool{opts.threads};
+    run_all(report, "static_thread_pool", pool.get_scheduler(), opts);
+  }
+  {
+    exec_old::static_thread_pool pool{opts.threads};
+    run_all(report, "static_thread_pool_old", pool.get_scheduler(), opts);
+  }
+  // The system context decides on its own number of threads.
+  run_all(report, "system_context", exec::get_system_scheduler(), opts);
+#if STDEXEC_SUITE_WITH_TBB
+  {
+    execpools::tbb_thread_pool pool{static_cast<int>(opts.threads)};
+    run_all(report, "tbb", pool.get_scheduler(), opts);
+  }
+#endif
+#if STDEXEC_SUITE_WITH_TASKFLOW
+  {
+    execpools::taskflow_thread_pool pool{opts.threads};
+    run_all(report, "taskflow", pool.get_scheduler(), opts);
+  }
+#endif
+#if STDEXEC_SUITE_WITH_ASIO
+  {
+    execpools::asio_thread_pool pool{opts.threads};
+    run_all(report, "asio", pool.get_scheduler(), opts);
+  }
+#endif
+}
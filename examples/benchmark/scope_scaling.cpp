@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Measures how the spawn rate of async scopes scales with the number of spawning threads:
+//
+//   example.benchmark.scope_scaling [--spawns-per-thread N] [--max-threads N]
+//
+// Every thread spawns `just()` into a shared scope in a loop, so each spawn starts and
+// completes inline and the benchmark measures the cost of counting work in and out of the
+// scope. The operation states are allocated with `exec::op_state_allocator` to keep the
+// system allocator out of the measurement.
+
+#include <barrier>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <exec/async_scope.hpp>
+#include <exec/op_state_allocator.hpp>
+#include <exec/sharded_scope.hpp>
+#include <stdexec/execution.hpp>
+
+namespace {
+  using clock_type = std::chrono::steady_clock;
+
+  struct options {
+    std::size_t spawns_per_thread = 200'000;
+    std::size_t max_threads = 128;
+  };
+
+  template <class Scope>
+  auto measure(Scope& scope, std::size_t num_threads, const options& opts) -> double {
+    std::barrier start{static_cast<std::ptrdiff_t>(num_threads + 1)};
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads);
+    for (std::size_t t = 0; t < num_threads; ++t) {
+      threads.emplace_back([&] {
+        auto env = stdexec::prop{stdexec::get_allocator, exec::op_state_allocator<>{}};
+        start.arrive_and_wait();
+        for (std::size_t i = 0; i < opts.spawns_per_thread; ++i) {
+          scope.spawn(stdexec::just(), env);
+        }
+      });
+    }
+    start.arrive_and_wait();
+    const auto begin = clock_type::now();
+    for (auto& thread: threads) {
+      thread.join();
+    }
+    const std::chrono::duration<double> elapsed = clock_type::now() - begin;
+    return static_cast<double>(num_threads * opts.spawns_per_thread) / elapsed.count();
+  }
+
+  auto parse_options(int argc, char** argv) -> options {
+    options opts;
+    for (int i = 1; i + 1 < argc; i += 2) {
+      std::string_view arg = argv[i];
+      if (arg == "--spawns-per-thread") {
+        opts.spawns_per_thread = std::strtoul(argv[i + 1], nullptr, 10);
+      } else if (arg == "--max-threads") {
+        opts.max_threads = std::strtoul(argv[i + 1], nullptr, 10);
+      } else {
+        std::cerr << "Usage: example.benchmark.scope_scaling [--spawns-per-thread N] "
+                     "[--max-threads N]"
+                  << std::endl;
+        std::exit(-1);
+      }
+    }
+    return opts;
+  }
+} // namespace
+
+int main(int argc, char** argv) {
+  const options opts = parse_options(argc, argv);
+  std::cout << std::setw(8) << "threads" << std::setw(20) << "async_scope" << std::setw(20)
+            << "sharded_scope" << "   (spawns per second)\n";
+  for (std::size_t num_threads = 1; num_threads <= opts.max_threads; num_threads *= 2) {
+    double async_rate = 0.0;
+    {
+      exec::async_scope scope;
+      async_rate = measure(scope, num_threads, opts);
+      stdexec::sync_wait(scope.on_empty());
+    }
+    double sharded_rate = 0.0;
+    {
+      exec::sharded_scope scope;
+      sharded_rate = measure(scope, num_threads, opts);
+      scope.close();
+      stdexec::sync_wait(scope.on_empty());
+    }
+    std::cout << std::setw(8) << num_threads << std::fixed << std::setprecision(0)
+              << std::setw(20) << async_rate << std::setw(20) << sharded_rate << std::endl;
+  }
+}
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string_view>
+#include <thread>
+#include <variant>
+#include <vector>
+
+#include <execpools/tbb/tbb_thread_pool.hpp>
+#include <exec/sort.hpp>
+#include <exec/static_thread_pool.hpp>
+
+#include <stdexec/execution.hpp>
+
+template <typename duration, typename F>
+auto measure(F&& f) {
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  f();
+  return std::chrono::duration_cast<duration>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv) {
+  if (argc < 4) {
+    std::cerr << "Usage: example.benchmark.sort n nruns {std|static|tbb} [stable]" << std::endl;
+    return -1;
+  }
+
+  // skip 'warmup' iterations for performance measurements
+  static constexpr size_t warmup = 1;
+
+  std::size_t n = std::strtoul(argv[1], nullptr, 10);
+  std::size_t nruns = std::strtoul(argv[2], nullptr, 10);
+  std::string_view impl = argv[3];
+  bool stable = argc > 4 && argv[4] == std::string_view("stable");
+
+  if (nruns <= warmup) {
+    std::cerr << "nruns should be >= " << warmup << std::endl;
+    return -1;
+  }
+
+  std::vector<std::uint64_t> input(n);
+  std::mt19937_64 rng{42};
+  std::generate(input.begin(), input.end(), rng);
+
+  auto sort_on = [&](auto sched, std::vector<std::uint64_t>& keys) {
+    if (stable) {
+      stdexec::sync_wait(exec::stable_sort(sched, keys));
+    } else {
+      stdexec::sync_wait(exec::sort(sched, keys));
+    }
+  };
+
+  std::variant<std::monostate, execpools::tbb_thread_pool, exec::static_thread_pool> pool;
+  if (impl == "tbb") {
+    pool.emplace<execpools::tbb_thread_pool>(static_cast<int>(std::thread::hardware_concurrency()));
+  } else if (impl == "static") {
+    pool.emplace<exec::static_thread_pool>(
+      std::thread::hardware_concurrency(), exec::bwos_params{}, exec::get_numa_policy());
+  } else if (impl != "std") {
+    std::cerr << "Unknown implementation: " << impl << std::endl;
+    return -1;
+  }
+
+  std::vector<unsigned long> times;
+  std::vector<std::uint64_t> keys;
+  for (unsigned long i = 0; i < nruns; ++i) {
+    keys = input;
+    auto time = measure<std::chrono::milliseconds>([&] {
+      std::visit(
+        [&]<class Pool>(Pool& pool) {
+          if constexpr (std::same_as<Pool, std::monostate>) {
+            if (stable) {
+              std::stable_sort(keys.begin(), keys.end());
+            } else {
+              std::sort(keys.begin(), keys.end());
+            }
+          } else {
+            sort_on(pool.get_scheduler(), keys);
+          }
+        },
+        pool);
+    });
+    times.push_back(static_cast<unsigned int>(time));
+  }
+
+  std::cout << "Avg time: "
+            << (std::accumulate(times.begin() + warmup, times.end(), 0u) / (times.size() - warmup))
+            << "ms. Sorted: " << std::boolalpha << std::is_sorted(keys.begin(), keys.end())
+            << std::endl;
+}
@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Measures the round trips per second of a TCP echo server on the loopback interface:
+//
+//   example.benchmark.tcp_echo [--connections N] [--requests N] [--message-size N]
+//
+// Every connection has a client thread that sends a message and waits for its echo in a loop.
+// The server either runs all connections on a single io_uring_context, or runs one thread per
+// connection with blocking system calls.
+
+#include <stdexec/execution.hpp>
+
+#if !STDEXEC_STD_NO_COROUTINES() && !STDEXEC_NVHPC()
+#  include <exec/async_scope.hpp>
+#  include <exec/linux/io_uring_context.hpp>
+#  include <exec/task.hpp>
+
+#  include <arpa/inet.h>
+#  include <netinet/in.h>
+#  include <netinet/tcp.h>
+#  include <sys/socket.h>
+#  include <unistd.h>
+
+#  include <barrier>
+#  include <chrono>
+#  include <cstddef>
+#  include <cstdlib>
+#  include <iomanip>
+#  include <iostream>
+#  include <span>
+#  include <string_view>
+#  include <system_error>
+#  include <thread>
+#  include <vector>
+
+namespace {
+  using clock_type = std::chrono::steady_clock;
+
+  struct options {
+    std::size_t connections = 64;
+    std::size_t requests = 10'000;
+    std::size_t message_size = 64;
+  };
+
+  void throw_if(bool cond) {
+    if (cond) {
+      throw std::system_error(errno, std::system_category());
+    }
+  }
+
+  // Opens a socket that listens on an ephemeral port of the loopback interface.
+  auto listen_on_loopback(::sockaddr_in& address) -> exec::safe_file_descriptor {
+    exec::safe_file_descriptor listener{::socket(AF_INET, SOCK_STREAM, 0)};
+    throw_if(!listener);
+    address = ::sockaddr_in{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    ::socklen_t length = sizeof(address);
+    throw_if(::bind(listener, reinterpret_cast<::sockaddr*>(&address), length) != 0);
+    throw_if(::listen(listener, SOMAXCONN) != 0);
+    throw_if(::getsockname(listener, reinterpret_cast<::sockaddr*>(&address), &length) != 0);
+    return listener;
+  }
+
+  void set_no_delay(int fd) {
+    int one = 1;
+    throw_if(::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one)) != 0);
+  }
+
+  // Receives exactly `buffer.size()` bytes. Returns false at the end of the stream.
+  auto recv_all(int fd, std::span<char> buffer) -> bool {
+    while (!buffer.empty()) {
+      auto n = ::recv(fd, buffer.data(), buffer.size(), 0);
+      if (n <= 0) {
+        return false;
+      }
+      buffer = buffer.subspan(static_cast<std::size_t>(n));
+    }
+    return true;
+  }
+
+  void send_all(int fd, std::span<const char> buffer) {
+    while (!buffer.empty()) {
+      auto n = ::send(fd, buffer.data(), buffer.size(), MSG_NOSIGNAL);
+      throw_if(n < 0);
+      buffer = buffer.subspan(static_cast<std::size_t>(n));
+    }
+  }
+
+  // Connects the clients, lets them run their requests and returns the round trips per second.
+  auto run_clients(const ::sockaddr_in& address, const options& opts) -> double {
+    std::barrier start{static_cast<std::ptrdiff_t>(opts.connections + 1)};
+    std::vector<std::thread> clients;
+    clients.reserve(opts.connections);
+    for (std::size_t c = 0; c < opts.connections; ++c) {
+      clients.emplace_back([&] {
+        exec::safe_file_descriptor fd{::socket(AF_INET, SOCK_STREAM, 0)};
+        throw_if(!fd);
+        throw_if(
+          ::connect(fd, reinterpret_cast<const ::sockaddr*>(&address), sizeof(address)) != 0);
+        set_no_delay(fd);
+        std::vector<char> message(opts.message_size, 'x');
+        std::vector<char> echo(opts.message_size);
+        start.arrive_and_wait();
+        for (std::size_t i = 0; i < opts.requests; ++i) {
+          send_all(fd, message);
+          if (!recv_all(fd, echo)) {
+            break;
+          }
+        }
+      });
+    }
+    start.arrive_and_wait();
+    const auto begin = clock_type::now();
+    for (auto& client: clients) {
+      client.join();
+    }
+    const std::chrono::duration<double> elapsed = clock_type::now() - begin;
+    return static_cast<double>(opts.connections * opts.requests) / elapsed.count();
+  }
+
+  auto echo(exec::io_uring_scheduler scheduler, int fd, std::size_t message_size)
+    -> exec::task<void> {
+    std::vector<std::byte> buffer(message_size);
+    while (std::size_t n = co_await scheduler.async_recv(fd, buffer)) {
+      for (std::size_t sent = 0; sent < n;) {
+        sent += co_await scheduler.async_send(fd, std::span{buffer}.subspan(sent, n - sent));
+      }
+    }
+    co_await scheduler.async_close(fd);
+  }
+
+  auto accept_all(
+    exec::io_uring_scheduler scheduler,
+    exec::async_scope& scope,
+    int listener,
+    const options& opts) -> exec::task<void> {
+    for (std::size_t c = 0; c < opts.connections; ++c) {
+      int fd = co_await scheduler.async_accept(listener);
+      set_no_delay(fd);
+      scope.spawn(echo(scheduler, fd, opts.message_size));
+    }
+  }
+
+  auto measure_io_uring(const options& opts) -> double {
+    ::sockaddr_in address{};
+    exec::safe_file_descriptor listener = listen_on_loopback(address);
+    exec::io_uring_context context;
+    exec::io_uring_scheduler scheduler = context.get_scheduler();
+    std::thread io_thread{[&] {
+      context.run_until_stopped();
+    }};
+    exec::async_scope scope;
+    scope.spawn(stdexec::starts_on(scheduler, accept_all(scheduler, scope, listener, opts)));
+    const double rate = run_clients(address, opts);
+    stdexec::sync_wait(scope.on_empty());
+    context.request_stop();
+    io_thread.join();
+    return rate;
+  }
+
+  auto measure_thread_per_connection(const options& opts) -> double {
+    ::sockaddr_in address{};
+    exec::safe_file_descriptor listener = listen_on_loopback(address);
+    std::vector<std::thread> servers;
+    servers.reserve(opts.connections);
+    std::thread acceptor{[&] {
+      for (std::size_t c = 0; c < opts.connections; ++c) {
+        int fd = ::accept4(listener, nullptr, nullptr, SOCK_CLOEXEC);
+        throw_if(fd < 0);
+        set_no_delay(fd);
+        servers.emplace_back([fd, &opts] {
+          exec::safe_file_descriptor connection{fd};
+          std::vector<char> buffer(opts.message_size);
+          for (;;) {
+            auto n = ::recv(connection, buffer.data(), buffer.size(), 0);
+            if (n <= 0) {
+              break;
+            }
+            send_all(connection, std::span{buffer}.first(static_cast<std::size_t>(n)));
+          }
+        });
+      }
+    }};
+    const double rate = run_clients(address, opts);
+    acceptor.join();
+    for (auto& server: servers) {
+      server.join();
+    }
+    return rate;
+  }
+
+  auto parse_options(int argc, char** argv) -> options {
+    options opts;
+    for (int i = 1; i + 1 < argc; i += 2) {
+      std::string_view arg = argv[i];
+      if (arg == "--connections") {
+        opts.connections = std::strtoul(argv[i + 1], nullptr, 10);
+      } else if (arg == "--requests") {
+        opts.requests = std::strtoul(argv[i + 1], nullptr, 10);
+      } else if (arg == "--message-size") {
+        opts.message_size = std::strtoul(argv[i + 1], nullptr, 10);
+      } else {
+        std::cerr << "Usage: example.benchmark.tcp_echo [--connections N] [--requests N] "
+                     "[--message-size N]"
+                  << std::endl;
+        std::exit(-1);
+      }
+    }
+    return opts;
+  }
+} // namespace
+
+int main(int argc, char** argv) {
+  const options opts = parse_options(argc, argv);
+  std::cout << std::setw(24) << "server" << std::setw(20) << "round trips" << "   (per second)\n";
+  std::cout << std::fixed << std::setprecision(0);
+  std::cout << std::setw(24) << "io_uring_context" << std::setw(20) << measure_io_uring(opts)
+            << std::endl;
+  std::cout << std::setw(24) << "thread per connection" << std::setw(20)
+            << measure_thread_per_connection(opts) << std::endl;
+}
+#else
+int main() {
+}
+#endif
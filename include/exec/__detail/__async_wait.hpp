@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../../stdexec/execution.hpp"
+#include "../../stdexec/__detail/__intrusive_queue.hpp"
+#include "../../stdexec/__detail/__optional.hpp"
+
+#include "./__intrusive_list.hpp"
+
+namespace exec {
+  // The waiting machinery shared by the asynchronous synchronization primitives: async_mutex,
+  // async_semaphore, async_shared_mutex, async_latch and async_barrier.
+  //
+  // A primitive `_Primitive` provides
+  //
+  //   static constexpr bool __stoppable;
+  //   auto __try_fast(__waiter*) noexcept -> bool;
+  //   auto __wait_or_enqueue(__waiter*) noexcept -> __wait_result;
+  //   auto __cancel(__waiter*) noexcept -> bool;
+  //   void __give_back(__waiter*) noexcept;
+  //
+  // `__try_fast` is the lock-free fast path. `__wait_or_enqueue` takes the primitive's lock and
+  // either lets the waiter through or queues it. `__cancel` dequeues a waiter whose stop token
+  // has been triggered and returns true, or returns false if the waiter is not queued, either
+  // because it has been woken or because it is yet to be queued, in which case it marks the
+  // waiter so that `__wait_or_enqueue` reports it as stopped. `__give_back` returns what a woken
+  // waiter was handed, such as a permit or ownership, when it fails to resume on its scheduler.
+  namespace __async_wait {
+    using namespace stdexec;
+
+    struct __waiter {
+      __waiter* __prev_ = nullptr;
+      __waiter* __next_ = nullptr;
+      // Called without the primitive's lock held once the waiter may proceed.
+      void (*__wake_)(__waiter*) noexcept = nullptr;
+      // What the waiter waits for, such as shared or exclusive ownership. Up to the primitive.
+      int __kind_ = 0;
+      // Guarded by the primitive's lock.
+      bool __queued_ = false;
+      bool __stop_requested_ = false;
+    };
+
+    enum class __wait_result {
+      __ready,
+      __stopped,
+      __queued
+    };
+
+    //! The FIFO queue of waiters of a primitive. It must only be used under the primitive's lock.
+    class __waiter_list {
+     public:
+      [[nodiscard]]
+      auto empty() const noexcept -> bool {
+        return __list_.empty();
+      }
+
+      [[nodiscard]]
+      auto front() const noexcept -> __waiter* {
+        return __list_.front();
+      }
+
+      void push_back(__waiter* __wtr) noexcept {
+        __wtr->__queued_ = true;
+        __list_.push_back(__wtr);
+      }
+
+      [[nodiscard]]
+      auto pop_front() noexcept -> __waiter* {
+        __waiter* __wtr = __list_.pop_front();
+        __wtr->__queued_ = false;
+        return __wtr;
+      }
+
+      //! Implements the bookkeeping of `__cancel`.
+      auto __try_remove(__waiter* __wtr) noexcept -> bool {
+        if (!__wtr->__queued_) {
+          __wtr->__stop_requested_ = true;
+          return false;
+        }
+        __wtr->__queued_ = false;
+        __list_.remove(__wtr);
+        return true;
+      }
+
+     private:
+      __intrusive_list<&__waiter::__prev_, &__waiter::__next_> __list_;
+    };
+
+    using __wake_list = __intrusive_queue<&__waiter::__next_>;
+
+    //! Wakes the waiters that were dequeued under the primitive's lock, after it is released.
+    inline void __wake_all(__wake_list& __woken) noexcept {
+      while (!__woken.empty()) {
+        __waiter* __wtr = __woken.pop_front();
+        __wtr->__wake_(__wtr);
+      }
+    }
+
+    template <class _Op>
+    struct __resume_rcvr {
+      using receiver_concept = receiver_t;
+      _Op* __op_;
+
+      void set_value() noexcept {
+        __op_->__resumed();
+      }
+
+      // The waiter owns the resource it was woken for, so it gives it back before it completes.
+      template <class _Error>
+      void set_error(_Error&& __err) noexcept {
+        __op_->__resume_failed(set_error_t(), static_cast<_Error&&>(__err));
+      }
+
+      void set_stopped() noexcept {
+        __op_->__resume_failed(set_stopped_t());
+      }
+    };
+
+    //! `_Sigs` plus the error and stopped completions of the scheduler in `_Env`, if any, that a
+    //! woken waiter resumes on; the waiter forwards them if it fails to resume.
+    template <class _Env, class _Sigs, bool = __callable<get_scheduler_t, _Env>>
+    struct __with_resume_completions {
+      using __t = _Sigs;
+    };
+
+    template <class _Env, class _Sigs>
+    struct __with_resume_completions<_Env, _Sigs, true> {
+      using __t = transform_completion_signatures_of<
+        schedule_result_t<__call_result_t<get_scheduler_t, _Env>&>,
+        _Env,
+        _Sigs,
+        __mconst<completion_signatures<>>::__f>;
+    };
+
+    template <class _Env, class _Sigs>
+    using __with_resume_completions_t = typename __with_resume_completions<_Env, _Sigs>::__t;
+
+    template <class _Receiver, class _Op, bool = __callable<get_scheduler_t, env_of_t<_Receiver>>>
+    struct __resume_op {
+      struct __t { };
+    };
+
+    template <class _Receiver, class _Op>
+    struct __resume_op<_Receiver, _Op, true> {
+      using __sched_t = __call_result_t<get_scheduler_t, env_of_t<_Receiver>>;
+      using __t = connect_result_t<schedule_result_t<__sched_t&>, __resume_rcvr<_Op>>;
+    };
+
+    template <class _Primitive, class _ReceiverId>
+    struct __operation {
+      using _Receiver = stdexec::__t<_ReceiverId>;
+
+      struct __t : __waiter {
+        using __id = __operation;
+
+        __t(_Primitive* __prim, int __kind, _Receiver __rcvr)
+          noexcept(__nothrow_move_constructible<_Receiver>)
+          : __waiter{.__wake_ = &__wake_impl, .__kind_ = __kind}
+          , __prim_(__prim)
+          , __rcvr_(static_cast<_Receiver&&>(__rcvr)) {
+        }
+
+        void start() & noexcept {
+          if (__prim_->__try_fast(this)) {
+            stdexec::set_value(static_cast<_Receiver&&>(__rcvr_));
+            return;
+          }
+          if constexpr (__stoppable) {
+            auto __token = get_stop_token(stdexec::get_env(__rcvr_));
+            if (__token.stop_requested()) {
+              stdexec::set_stopped(static_cast<_Receiver&&>(__rcvr_));
+              return;
+            }
+            __on_stop_.emplace(__token, __on_stop_requested{this});
+          }
+          switch (__prim_->__wait_or_enqueue(this)) {
+          case __wait_result::__ready:
+            __on_stop_.reset();
+            stdexec::set_value(static_cast<_Receiver&&>(__rcvr_));
+            break;
+          case __wait_result::__stopped:
+            __complete_stopped();
+            break;
+          case __wait_result::__queued:
+            // do not access this
+            break;
+          }
+        }
+
+       private:
+        template <class>
+        friend struct __resume_rcvr;
+
+        using __stop_token_t = stop_token_of_t<env_of_t<_Receiver>>;
+
+        static constexpr bool __stoppable = _Primitive::__stoppable
+                                         && !unstoppable_token<__stop_token_t>;
+
+        struct __on_stop_requested {
+          __t* __self_;
+
+          void operator()() const noexcept {
+            if (__self_->__prim_->__cancel(__self_)) {
+              __self_->__complete_stopped();
+            }
+          }
+        };
+
+        using __stop_callback_t = stop_callback_for_t<__stop_token_t, __on_stop_requested>;
+
+        // A waiter that is woken resumes on the scheduler of its receiver's environment, if it
+        // has one, so that the thread that released the primitive does not run its continuation.
+        static constexpr bool __resumes_on_scheduler =
+          __callable<get_scheduler_t, env_of_t<_Receiver>>;
+
+        using __resume_op_t = typename __resume_op<_Receiver, __t>::__t;
+
+        static void __wake_impl(__waiter* __wtr) noexcept {
+          auto* __self = static_cast<__t*>(__wtr);
+          __self->__on_stop_.reset();
+          if constexpr (__resumes_on_scheduler) {
+            stdexec::start(__self->__resume_op_.emplace(__emplace_from{[__self] {
+              auto __sched = get_scheduler(stdexec::get_env(__self->__rcvr_));
+              return stdexec::connect(stdexec::schedule(__sched), __resume_rcvr<__t>{__self});
+            }}));
+          } else {
+            __self->__resumed();
+          }
+        }
+
+        void __resumed() noexcept {
+          stdexec::set_value(static_cast<_Receiver&&>(__rcvr_));
+        }
+
+        template <class _Tag, class... _As>
+        void __resume_failed(_Tag, _As&&... __as) noexcept {
+          __prim_->__give_back(this);
+          _Tag()(static_cast<_Receiver&&>(__rcvr_), static_cast<_As&&>(__as)...);
+        }
+
+        void __complete_stopped() noexcept {
+          __on_stop_.reset();
+          stdexec::set_stopped(static_cast<_Receiver&&>(__rcvr_));
+        }
+
+        _Primitive* __prim_;
+        STDEXEC_ATTRIBUTE((no_unique_address)) _Receiver __rcvr_;
+        stdexec::__optional<__stop_callback_t> __on_stop_;
+        STDEXEC_ATTRIBUTE((no_unique_address)) stdexec::__optional<__resume_op_t> __resume_op_;
+      };
+    };
+
+    //! The sender returned by the waiting functions of the primitives, such as
+    //! `async_mutex::lock()`.
+    template <class _Primitive>
+    struct __sender {
+      using sender_concept = sender_t;
+
+      template <class _Env>
+      using __completions_t = __with_resume_completions_t<
+        _Env,
+        stdexec::completion_signatures<set_value_t(), set_stopped_t()>>;
+
+      template <class _Receiver>
+      using __operation_t = stdexec::__t<__operation<_Primitive, __id<__decay_t<_Receiver>>>>;
+
+      template <receiver _Receiver>
+        requires receiver_of<_Receiver, __completions_t<env_of_t<_Receiver>>>
+      auto connect(_Receiver __rcvr) const noexcept(__nothrow_move_constructible<_Receiver>)
+        -> __operation_t<_Receiver> {
+        return {__prim_, __kind_, static_cast<_Receiver&&>(__rcvr)};
+      }
+
+      template <class _Env>
+      static auto get_completion_signatures(const __sender&, _Env&&) -> __completions_t<_Env> {
+        return {};
+      }
+
+      _Primitive* __prim_;
+      int __kind_ = 0;
+    };
+  } // namespace __async_wait
+} // namespace exec
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../../stdexec/__detail/__config.hpp"
+
+#include <utility>
+
+namespace exec {
+  //! A doubly-linked intrusive FIFO list that supports removing any item in constant time.
+  template <auto _PrevPtr, auto _NextPtr>
+  class __intrusive_list;
+
+  template <class _Tp, _Tp* _Tp::*_PrevPtr, _Tp* _Tp::*_NextPtr>
+  class __intrusive_list<_PrevPtr, _NextPtr> {
+   public:
+    __intrusive_list() noexcept = default;
+
+    __intrusive_list(__intrusive_list&& __other) noexcept
+      : __head_(std::exchange(__other.__head_, nullptr))
+      , __tail_(std::exchange(__other.__tail_, nullptr)) {
+    }
+
+    ~__intrusive_list() {
+      STDEXEC_ASSERT(empty());
+    }
+
+    [[nodiscard]]
+    auto empty() const noexcept -> bool {
+      return __head_ == nullptr;
+    }
+
+    [[nodiscard]]
+    auto front() const noexcept -> _Tp* {
+      return __head_;
+    }
+
+    void push_back(_Tp* __item) noexcept {
+      STDEXEC_ASSERT(__item != nullptr);
+      __item->*_PrevPtr = __tail_;
+      __item->*_NextPtr = nullptr;
+      if (__tail_ == nullptr) {
+        __head_ = __item;
+      } else {
+        __tail_->*_NextPtr = __item;
+      }
+      __tail_ = __item;
+    }
+
+    [[nodiscard]]
+    auto pop_front() noexcept -> _Tp* {
+      STDEXEC_ASSERT(!empty());
+      _Tp* __item = __head_;
+      remove(__item);
+      return __item;
+    }
+
+    //! Removes `__item`, which must be in this list.
+    void remove(_Tp* __item) noexcept {
+      STDEXEC_ASSERT(__item != nullptr);
+      _Tp* __prev = std::exchange(__item->*_PrevPtr, nullptr);
+      _Tp* __next = std::exchange(__item->*_NextPtr, nullptr);
+      if (__prev == nullptr) {
+        __head_ = __next;
+      } else {
+        __prev->*_NextPtr = __next;
+      }
+      if (__next == nullptr) {
+        __tail_ = __prev;
+      } else {
+        __next->*_PrevPtr = __prev;
+      }
+    }
+
+   private:
+    _Tp* __head_ = nullptr;
+    _Tp* __tail_ = nullptr;
+  };
+} // namespace exec
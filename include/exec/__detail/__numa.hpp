@@ -218,8 +218,16 @@ namespace exec {
 
 #if STDEXEC_ENABLE_NUMA
 #  include <numa.h>
+#  include <sched.h>
 
 namespace exec {
+  //! Returns the NUMA node of the CPU that the calling thread is running on.
+  inline int _get_current_numa_node() noexcept {
+    int cpu = ::sched_getcpu();
+    int node = cpu < 0 ? -1 : ::numa_node_of_cpu(cpu);
+    return node < 0 ? 0 : node;
+  }
+
   inline std::size_t _get_numa_num_cpus(int node) {
     struct ::bitmask* cpus = ::numa_allocate_cpumask();
     if (!cpus) {
@@ -383,6 +391,10 @@ namespace exec {
 namespace exec {
   using default_numa_policy = no_numa_policy;
 
+  inline auto _get_current_numa_node() noexcept -> int {
+    return 0;
+  }
+
   inline auto get_numa_policy() noexcept -> numa_policy {
     return numa_policy{default_numa_policy{}};
   }
@@ -17,20 +17,31 @@
 
 #include "__system_context_replaceability_api.hpp"
 #include "stdexec/execution.hpp"
+#include "exec/op_state_allocator.hpp"
 #include "exec/static_thread_pool.hpp"
+#include "exec/timed_thread_scheduler.hpp"
+
+#include <mutex>
+#include <optional>
 
 namespace exec::__system_context_default_impl {
   using namespace stdexec::tags;
   using system_context_replaceability::receiver;
   using system_context_replaceability::bulk_item_receiver;
+  using system_context_replaceability::bulk_chunk_receiver;
   using system_context_replaceability::storage;
   using system_context_replaceability::system_scheduler;
+  using system_context_replaceability::system_scheduler_v2;
+  using system_context_replaceability::system_scheduler_v3;
+  using system_context_replaceability::timer_receiver;
   using system_context_replaceability::__system_context_replaceability;
+  using system_context_replaceability::__system_context_replaceability_v2;
+  using system_context_replaceability::__system_context_replaceability_v3;
 
   using __pool_scheduler_t = decltype(std::declval<exec::static_thread_pool>().get_scheduler());
 
   /// Receiver that calls the callback when the operation completes.
-  template <class _Sender>
+  template <class _Sender, class _Receiver = receiver>
   struct __operation;
 
   /*
@@ -56,15 +67,15 @@ namespace exec::__system_context_default_impl {
   [*] sizes taken on an Apple M2 Pro arm64 arch. They may differ on other architectures, or with different implementations.
   */
 
-  template <class _Sender>
+  template <class _Sender, class _Receiver = receiver>
   struct __recv {
     using receiver_concept = stdexec::receiver_t;
 
     //! The operation state on the frontend.
-    receiver* __r_;
+    _Receiver* __r_;
 
     //! The parent operation state that we will destroy when we complete.
-    __operation<_Sender>* __op_;
+    __operation<_Sender, _Receiver>* __op_;
 
     void set_value() noexcept {
       auto __op = __op_;
@@ -89,6 +100,15 @@ namespace exec::__system_context_default_impl {
       __op->__destruct(); // destroys the operation, including `this`.
       __r->set_stopped();
     }
+
+    //! Passes the stop token of a timed operation on the frontend to the backend operation.
+    auto get_env() const noexcept {
+      if constexpr (std::derived_from<_Receiver, timer_receiver>) {
+        return stdexec::prop{stdexec::get_stop_token, __r_->get_stop_token()};
+      } else {
+        return stdexec::env<>{};
+      }
+    }
   };
 
   /// Ensure that `__storage` is aligned to `__alignment`. Shrinks the storage, if needed, to match desired alignment.
@@ -106,19 +126,27 @@ namespace exec::__system_context_default_impl {
     }
   }
 
-  template <typename _Sender>
+  template <typename _Sender, class _Receiver>
   struct __operation {
     /// The inner operation state, that results out of connecting the underlying sender with the receiver.
-    stdexec::connect_result_t<_Sender, __recv<_Sender>> __inner_op_;
+    stdexec::connect_result_t<_Sender, __recv<_Sender, _Receiver>> __inner_op_;
     /// True if the operation is on the heap, false if it is in the preallocated space.
     bool __on_heap_;
 
     /// Try to construct the operation in the preallocated memory if it fits, otherwise allocate a new operation.
     static __operation*
-      __construct_maybe_alloc(storage __storage, receiver* __completion, _Sender __sndr) {
+      __construct_maybe_alloc(storage __storage, _Receiver* __completion, _Sender __sndr) {
       __storage = __ensure_alignment(__storage, alignof(__operation));
       if (__storage.__data == nullptr || __storage.__size < sizeof(__operation)) {
-        return new __operation(std::move(__sndr), __completion, true);
+        // The operation is typically freed on a pool thread, which the allocator handles well.
+        op_state_allocator<__operation> __alloc;
+        void* __ptr = __alloc.allocate(1);
+        try {
+          return ::new (__ptr) __operation(std::move(__sndr), __completion, true);
+        } catch (...) {
+          __alloc.deallocate(static_cast<__operation*>(__ptr), 1);
+          throw;
+        }
       } else {
         return new (__storage.__data) __operation(std::move(__sndr), __completion, false);
       }
@@ -132,28 +160,91 @@ namespace exec::__system_context_default_impl {
     /// Destructs the operation; frees any allocated memory.
     void __destruct() {
       if (__on_heap_) {
-        delete this;
+        std::destroy_at(this);
+        op_state_allocator<__operation>().deallocate(this, 1);
       } else {
         std::destroy_at(this);
       }
     }
 
    private:
-    __operation(_Sender __sndr, receiver* __completion, bool __on_heap)
-      : __inner_op_(stdexec::connect(std::move(__sndr), __recv<_Sender>{__completion, this}))
+    __operation(_Sender __sndr, _Receiver* __completion, bool __on_heap)
+      : __inner_op_(
+          stdexec::connect(std::move(__sndr), __recv<_Sender, _Receiver>{__completion, this}))
       , __on_heap_(__on_heap) {
     }
   };
 
-  struct __system_scheduler_impl : system_scheduler {
+  /// Starts `__sndr` for a timed operation of the frontend, completing `__r`.
+  template <class _Sender>
+  void __start_timer(storage __storage, timer_receiver* __r, _Sender __sndr) noexcept {
+    try {
+      using __timer_operation_t = __operation<_Sender, timer_receiver>;
+      auto __os = __timer_operation_t::__construct_maybe_alloc(__storage, __r, std::move(__sndr));
+      __os->start();
+    } catch (std::exception& __e) {
+      __r->set_error(std::current_exception());
+    }
+  }
+
+  struct __system_scheduler_impl : system_scheduler_v3 {
     __system_scheduler_impl()
       : __pool_scheduler_(__pool_.get_scheduler()) {
     }
+
+    void schedule_after(
+      std::chrono::steady_clock::duration __duration,
+      storage __storage,
+      timer_receiver* __r) noexcept override {
+      try {
+        // The timer fires on the timer thread; the work runs on the pool.
+        __start_timer(
+          __storage,
+          __r,
+          stdexec::continues_on(
+            exec::schedule_after(__get_timer_scheduler(), __duration), __pool_scheduler_));
+      } catch (std::exception& __e) {
+        __r->set_error(std::current_exception());
+      }
+    }
+
+    void schedule_at(
+      std::chrono::steady_clock::time_point __time_point,
+      storage __storage,
+      timer_receiver* __r) noexcept override {
+      try {
+        __start_timer(
+          __storage,
+          __r,
+          stdexec::continues_on(
+            exec::schedule_at(__get_timer_scheduler(), __time_point), __pool_scheduler_));
+      } catch (std::exception& __e) {
+        __r->set_error(std::current_exception());
+      }
+    }
+
+   protected:
+    /// Returns the scheduler of the underlying thread pool, for backends that build on this one.
+    auto __get_pool_scheduler() const noexcept -> __pool_scheduler_t {
+      return __pool_scheduler_;
+    }
+
    private:
+    /// Returns the scheduler of the timer thread, which is only started once it is needed.
+    auto __get_timer_scheduler() -> exec::timed_thread_scheduler {
+      std::call_once(__timer_context_once_, [this] { __timer_context_.emplace(); });
+      return __timer_context_->get_scheduler();
+    }
+
     /// The underlying thread pool.
     exec::static_thread_pool __pool_;
     __pool_scheduler_t __pool_scheduler_;
 
+    /// The thread that waits for the timers of the frontend. It is stopped before the pool that
+    /// the timers complete on.
+    std::once_flag __timer_context_once_;
+    std::optional<exec::timed_thread_context> __timer_context_;
+
     //! Functor called by the `bulk` operation; sends a `start` signal to the frontend.
     struct __bulk_functor {
       bulk_item_receiver* __r_;
@@ -163,6 +254,16 @@ namespace exec::__system_context_default_impl {
       }
     };
 
+    //! Functor called by the `bulk_chunked` operation with the range of items assigned to a pool
+    //! thread; sends a `start` signal for the whole range to the frontend.
+    struct __bulk_chunk_functor {
+      bulk_chunk_receiver* __r_;
+
+      void operator()(uint32_t __begin, uint32_t __end) const noexcept {
+        __r_->start(__begin, __end);
+      }
+    };
+
     using __schedule_operation_t =
       __operation<decltype(stdexec::schedule(std::declval<__pool_scheduler_t>()))>;
 
@@ -171,6 +272,11 @@ namespace exec::__system_context_default_impl {
       std::declval<uint32_t>(),
       std::declval<__bulk_functor>()))>;
 
+    using __bulk_chunked_schedule_operation_t = __operation<decltype(exec::bulk_chunked(
+      stdexec::schedule(std::declval<__pool_scheduler_t>()),
+      std::declval<uint32_t>(),
+      std::declval<__bulk_chunk_functor>()))>;
+
    public:
     void schedule(storage __storage, receiver* __r) noexcept override {
       try {
@@ -195,6 +301,22 @@ namespace exec::__system_context_default_impl {
         __r->set_error(std::current_exception());
       }
     }
+
+    void bulk_schedule_chunked(
+      uint32_t __size,
+      storage __storage,
+      bulk_chunk_receiver* __r) noexcept override {
+      try {
+        // The pool splits the range into one chunk per thread.
+        auto __sndr = exec::bulk_chunked(
+          stdexec::schedule(__pool_scheduler_), __size, __bulk_chunk_functor{__r});
+        auto __os = __bulk_chunked_schedule_operation_t::__construct_maybe_alloc(
+          __storage, __r, std::move(__sndr));
+        __os->start();
+      } catch (std::exception& __e) {
+        __r->set_error(std::current_exception());
+      }
+    }
   };
 
   /// Keeps track of the object implementing the system context interfaces.
@@ -211,32 +333,85 @@ namespace exec::__system_context_default_impl {
       return __current_instance_;
     }
 
+    /// Get the currently selected system context object if it implements version 2 of the
+    /// interface, or null otherwise.
+    system_scheduler_v2* __get_current_instance_v2() const noexcept {
+      return __current_instance_v2_;
+    }
+
+    /// Get the currently selected system context object if it implements version 3 of the
+    /// interface, or null otherwise.
+    system_scheduler_v3* __get_current_instance_v3() const noexcept {
+      return __current_instance_v3_;
+    }
+
     /// Allows changing the currently selected system context object; used for testing.
     void __set_current_instance(system_scheduler* __instance) noexcept {
       __current_instance_ = __instance;
+      __current_instance_v2_ = nullptr;
+      __current_instance_v3_ = nullptr;
+    }
+
+    /// Allows changing the currently selected system context object to one that implements
+    /// version 2 of the interface.
+    void __set_current_instance(system_scheduler_v2* __instance) noexcept {
+      __current_instance_ = __instance;
+      __current_instance_v2_ = __instance;
+      __current_instance_v3_ = nullptr;
+    }
+
+    /// Allows changing the currently selected system context object to one that implements
+    /// version 3 of the interface.
+    void __set_current_instance(system_scheduler_v3* __instance) noexcept {
+      __current_instance_ = __instance;
+      __current_instance_v2_ = __instance;
+      __current_instance_v3_ = __instance;
     }
 
    private:
     __instance_holder() {
       static __system_scheduler_impl __default_instance_;
       __current_instance_ = &__default_instance_;
+      __current_instance_v2_ = &__default_instance_;
+      __current_instance_v3_ = &__default_instance_;
     }
 
     system_scheduler* __current_instance_;
+    system_scheduler_v2* __current_instance_v2_;
+    system_scheduler_v3* __current_instance_v3_;
   };
 
-  struct __system_context_replaceability_impl : __system_context_replaceability {
+  struct __system_context_replaceability_impl : __system_context_replaceability_v3 {
     //! Globally replaces the system scheduler backend.
     //! This needs to be called within `main()` and before the system scheduler is accessed.
     void __set_system_scheduler(system_scheduler* __backend) noexcept override {
       __instance_holder::__singleton().__set_current_instance(__backend);
     }
+
+    //! Globally replaces the system scheduler backend with one that implements version 2 of its
+    //! interface.
+    void __set_system_scheduler(system_scheduler_v2* __backend) noexcept override {
+      __instance_holder::__singleton().__set_current_instance(__backend);
+    }
+
+    //! Globally replaces the system scheduler backend with one that implements version 3 of its
+    //! interface.
+    void __set_system_scheduler(system_scheduler_v3* __backend) noexcept override {
+      __instance_holder::__singleton().__set_current_instance(__backend);
+    }
   };
 
   inline void* __default_query_system_context_interface(const __uuid& __id) noexcept {
     if (__id == system_scheduler::__interface_identifier) {
       return __instance_holder::__singleton().__get_current_instance();
-    } else if (__id == __system_context_replaceability::__interface_identifier) {
+    } else if (__id == system_scheduler_v2::__interface_identifier) {
+      return __instance_holder::__singleton().__get_current_instance_v2();
+    } else if (__id == system_scheduler_v3::__interface_identifier) {
+      return __instance_holder::__singleton().__get_current_instance_v3();
+    } else if (
+      __id == __system_context_replaceability::__interface_identifier
+      || __id == __system_context_replaceability_v2::__interface_identifier
+      || __id == __system_context_replaceability_v3::__interface_identifier) {
       static __system_context_replaceability_impl __impl;
       return &__impl;
     }
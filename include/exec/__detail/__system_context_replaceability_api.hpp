@@ -17,6 +17,9 @@
 #ifndef STDEXEC_SYSTEM_CONTEXT_REPLACEABILITY_API_H
 #define STDEXEC_SYSTEM_CONTEXT_REPLACEABILITY_API_H
 
+#include "../../stdexec/stop_token.hpp"
+
+#include <chrono>
 #include <cstdint>
 #include <exception>
 
@@ -68,6 +71,21 @@ namespace exec::system_context_replaceability {
     virtual void start(std::uint32_t) noexcept = 0;
   };
 
+  /// Receiver for bulk scheduling operations that the backend splits into chunks.
+  struct bulk_chunk_receiver : bulk_item_receiver {
+    using bulk_item_receiver::start;
+
+    /// Called for each chunk `[__begin, __end)` of the items of a bulk operation, possibly on
+    /// different threads. The chunks partition the items.
+    virtual void start(std::uint32_t __begin, std::uint32_t __end) noexcept = 0;
+  };
+
+  /// Receiver for timed scheduling operations.
+  struct timer_receiver : receiver {
+    /// Returns the token through which the frontend asks the backend to stop waiting.
+    virtual stdexec::inplace_stop_token get_stop_token() const noexcept = 0;
+  };
+
   /// Describes a storage space.
   /// Used to pass preallocated storage from the frontend to the backend.
   struct storage {
@@ -90,6 +108,36 @@ namespace exec::system_context_replaceability {
       bulk_schedule(std::uint32_t __n, storage __s, bulk_item_receiver* __r) noexcept = 0;
   };
 
+  /// Version 2 of the interface for the system scheduler. The backend hands bulk work to the
+  /// frontend a chunk of items at a time, rather than making one call per item.
+  struct system_scheduler_v2 : system_scheduler {
+    static constexpr __uuid __interface_identifier{0x3b6f1e0c9a2d4875, 0x8e41c7d25f09ab36};
+
+    /// Schedule bulk work of size `__n` on system scheduler, calling `__r` for chunks of items
+    /// of the backend's choosing and then when done, and using `__s` for preallocated memory.
+    virtual void
+      bulk_schedule_chunked(std::uint32_t __n, storage __s, bulk_chunk_receiver* __r) noexcept = 0;
+  };
+
+  /// Version 3 of the interface for the system scheduler, which adds timed scheduling.
+  /// Durations and time points are measured on `std::chrono::steady_clock`.
+  struct system_scheduler_v3 : system_scheduler_v2 {
+    static constexpr __uuid __interface_identifier{0xe41a7c3d5b9f2086, 0x91c6d8e03a4b57f2};
+
+    /// Schedule work on system scheduler once `__d` has elapsed, calling `__r` when done and using
+    /// `__s` for preallocated memory. Completes with `set_stopped()` if `__r` asks to stop first.
+    virtual void schedule_after(
+      std::chrono::steady_clock::duration __d,
+      storage __s,
+      timer_receiver* __r) noexcept = 0;
+    /// Schedule work on system scheduler at `__tp`, calling `__r` when done and using `__s` for
+    /// preallocated memory. Completes with `set_stopped()` if `__r` asks to stop first.
+    virtual void schedule_at(
+      std::chrono::steady_clock::time_point __tp,
+      storage __s,
+      timer_receiver* __r) noexcept = 0;
+  };
+
   /// Implementation-defined mechanism for replacing the system scheduler backend at run-time.
   struct __system_context_replaceability {
     static constexpr __uuid __interface_identifier{0xc008a3be3bb9284b, 0xb98edb3a740ee02c};
@@ -99,6 +147,28 @@ namespace exec::system_context_replaceability {
     virtual void __set_system_scheduler(system_scheduler*) noexcept = 0;
   };
 
+  /// Version 2 of the mechanism for replacing the system scheduler backend at run-time.
+  struct __system_context_replaceability_v2 : __system_context_replaceability {
+    static constexpr __uuid __interface_identifier{0x7d02e95ab4c1f368, 0xa5f38b0c2e7d4196};
+
+    using __system_context_replaceability::__set_system_scheduler;
+
+    /// Globally replaces the system scheduler backend with one that implements version 2 of its
+    /// interface. A backend set through version 1 is only used through version 1.
+    virtual void __set_system_scheduler(system_scheduler_v2*) noexcept = 0;
+  };
+
+  /// Version 3 of the mechanism for replacing the system scheduler backend at run-time.
+  struct __system_context_replaceability_v3 : __system_context_replaceability_v2 {
+    static constexpr __uuid __interface_identifier{0x2c58f1b7e60d93a4, 0xb3e7a4150c9f6d28};
+
+    using __system_context_replaceability_v2::__set_system_scheduler;
+
+    /// Globally replaces the system scheduler backend with one that implements version 3 of its
+    /// interface.
+    virtual void __set_system_scheduler(system_scheduler_v3*) noexcept = 0;
+  };
+
 } // namespace exec::system_context_replaceability
 
 #endif
@@ -0,0 +1,708 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../stdexec/execution.hpp"
+#include "../stdexec/__detail/__optional.hpp"
+
+#include "./__detail/__async_wait.hpp"
+#include "timed_scheduler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+
+namespace exec {
+  //! The error with which `admit` completes when it sheds an operation, either because no
+  //! slot was free or because none became free before the operation's queueing deadline.
+  struct load_shed_error : std::exception {
+    [[nodiscard]]
+    auto what() const noexcept -> const char* override {
+      return "exec::admit: the operation was shed";
+    }
+  };
+
+  //! A fixed limit on the number of operations in flight.
+  struct static_limit {
+    std::size_t limit = 64;
+  };
+
+  //! Additive increase, multiplicative decrease: the limit grows by one for each operation that
+  //! completes in time while at least half of the limit is in use, and shrinks by
+  //! `backoff_ratio` for each operation that fails or takes longer than `timeout`.
+  struct aimd_limit {
+    std::size_t initial_limit = 20;
+    std::size_t min_limit = 1;
+    std::size_t max_limit = 1000;
+    double backoff_ratio = 0.9;
+    std::chrono::steady_clock::duration timeout = std::chrono::seconds(5);
+
+    auto update(
+      std::size_t __limit,
+      std::size_t __in_flight,
+      std::chrono::steady_clock::duration __latency,
+      bool __dropped) noexcept -> std::size_t {
+      if (__dropped || __latency > timeout) {
+        return std::max(min_limit, static_cast<std::size_t>(__limit * backoff_ratio));
+      }
+      if (__in_flight * 2 >= __limit) {
+        return std::min(max_limit, __limit + 1);
+      }
+      return __limit;
+    }
+  };
+
+  //! Follows the ratio of the long-term average latency to the latency of each operation, in
+  //! the manner of the gradient limit of Netflix's concurrency-limits. While latencies stay
+  //! near their average the limit grows by about `queue_size` per sample; when they rise above
+  //! `tolerance` times the average it shrinks by up to half. The long-term average is taken
+  //! over roughly `long_window` samples.
+  struct gradient_limit {
+    std::size_t initial_limit = 20;
+    std::size_t min_limit = 1;
+    std::size_t max_limit = 1000;
+    double smoothing = 0.2;
+    double tolerance = 1.5;
+    std::size_t queue_size = 4;
+    std::size_t long_window = 600;
+
+    auto update(
+      std::size_t,
+      std::size_t __in_flight,
+      std::chrono::steady_clock::duration __latency,
+      bool) noexcept -> std::size_t {
+      if (__estimate_ == 0.0) {
+        __estimate_ = static_cast<double>(initial_limit);
+      }
+      const double __short_rtt = std::max(1.0, static_cast<double>(__latency.count()));
+      __long_rtt_ = __long_rtt_ == 0.0
+                    ? __short_rtt
+                    : __long_rtt_ + (__short_rtt - __long_rtt_) / static_cast<double>(long_window);
+      // Let the average catch up quickly once a latency spike is over.
+      if (__long_rtt_ / __short_rtt > 2.0) {
+        __long_rtt_ *= 0.95;
+      }
+      // Too few operations in flight to tell whether the limit is too high.
+      if (static_cast<double>(__in_flight) < __estimate_ / 2) {
+        return static_cast<std::size_t>(__estimate_);
+      }
+      const double __gradient = std::clamp(tolerance * __long_rtt_ / __short_rtt, 0.5, 1.0);
+      const double __target = __estimate_ * __gradient + static_cast<double>(queue_size);
+      __estimate_ = std::clamp(
+        __estimate_ * (1.0 - smoothing) + __target * smoothing,
+        static_cast<double>(min_limit),
+        static_cast<double>(max_limit));
+      return static_cast<std::size_t>(__estimate_);
+    }
+
+    double __long_rtt_ = 0.0;
+    double __estimate_ = 0.0;
+  };
+
+  namespace __admit {
+    using namespace stdexec;
+    using __async_wait::__wait_result;
+    using __async_wait::__waiter;
+    using __clock = std::chrono::steady_clock;
+
+    enum class __sample {
+      __succeeded,
+      __dropped,
+      __ignored
+    };
+
+    // The part of a limiter that does not depend on its limit algorithm.
+    //
+    // `__state_` holds the number of operations in flight shifted left by one, and a low bit
+    // that is set while the queue of waiters is non-empty, as in async_semaphore. Admitting and
+    // completing an operation is a single CAS while no one waits. While the bit is set,
+    // `__state_` only changes under `__mutex_`, and completing operations hand their slots to
+    // the waiters at the front of the queue.
+    //
+    // The limit algorithm runs under `__update_mutex_`. Completions that find it taken skip
+    // their sample rather than wait for it.
+    class __limiter_base {
+      static constexpr std::size_t __waiters_bit = 1;
+      static constexpr std::size_t __one_op = 2;
+
+     public:
+      using __update_fn = auto(__limiter_base*, std::size_t, std::size_t, __clock::duration, bool)
+        noexcept -> std::size_t;
+
+      __limiter_base(std::size_t __limit, __update_fn* __update) noexcept
+        : __limit_(std::max<std::size_t>(__limit, 1))
+        , __update_(__update) {
+      }
+
+      ~__limiter_base() {
+        STDEXEC_ASSERT(__waiters_.empty());
+      }
+
+      [[nodiscard]]
+      auto __limit() const noexcept -> std::size_t {
+        return __limit_.load(std::memory_order_relaxed);
+      }
+
+      [[nodiscard]]
+      auto __in_flight() const noexcept -> std::size_t {
+        return __state_.load(std::memory_order_relaxed) / __one_op;
+      }
+
+      auto __try_admit() noexcept -> bool {
+        std::size_t __state = __state_.load(std::memory_order_relaxed);
+        while ((__state & __waiters_bit) == 0 && __state / __one_op < __limit()) {
+          if (__state_.compare_exchange_weak(
+                __state, __state + __one_op, std::memory_order_acquire,
+                std::memory_order_relaxed)) {
+            return true;
+          }
+        }
+        return false;
+      }
+
+      auto __wait_or_enqueue(__waiter* __wtr) noexcept -> __wait_result {
+        std::lock_guard __lock{__mutex_};
+        if (__wtr->__stop_requested_) {
+          return __wait_result::__stopped;
+        }
+        std::size_t __state = __state_.load(std::memory_order_relaxed);
+        while ((__state & __waiters_bit) == 0) {
+          if (__state / __one_op < __limit()) {
+            if (__state_.compare_exchange_weak(
+                  __state, __state + __one_op, std::memory_order_acquire,
+                  std::memory_order_relaxed)) {
+              return __wait_result::__ready;
+            }
+          } else if (__state_.compare_exchange_weak(
+                       __state, __state | __waiters_bit, std::memory_order_relaxed)) {
+            break;
+          }
+        }
+        __waiters_.push_back(__wtr);
+        return __wait_result::__queued;
+      }
+
+      auto __cancel(__waiter* __wtr) noexcept -> bool {
+        std::lock_guard __lock{__mutex_};
+        if (!__waiters_.__try_remove(__wtr)) {
+          return false;
+        }
+        if (__waiters_.empty()) {
+          __state_.fetch_and(~__waiters_bit, std::memory_order_relaxed);
+        }
+        return true;
+      }
+
+      //! Feeds the latency of an admitted operation to the limit algorithm and frees its slot.
+      void __complete(__clock::duration __latency, __sample __smpl) noexcept {
+        if (__update_ != nullptr && __smpl != __sample::__ignored) {
+          std::unique_lock __lock{__update_mutex_, std::try_to_lock};
+          if (__lock.owns_lock()) {
+            const std::size_t __limit = __update_(
+              this, __limit_.load(std::memory_order_relaxed), __in_flight(), __latency,
+              __smpl == __sample::__dropped);
+            __limit_.store(std::max<std::size_t>(__limit, 1), std::memory_order_relaxed);
+          }
+        }
+        __release();
+      }
+
+     private:
+      void __release() noexcept {
+        std::size_t __state = __state_.load(std::memory_order_relaxed);
+        while ((__state & __waiters_bit) == 0) {
+          if (__state_.compare_exchange_weak(
+                __state, __state - __one_op, std::memory_order_release,
+                std::memory_order_relaxed)) {
+            return;
+          }
+        }
+
+        __async_wait::__wake_list __woken;
+        {
+          std::lock_guard __lock{__mutex_};
+          // The limit may have grown, so more than one waiter can get a slot.
+          __state = __state_.load(std::memory_order_relaxed) - __one_op;
+          while (!__waiters_.empty() && __state / __one_op < __limit()) {
+            __state += __one_op;
+            __woken.push_back(__waiters_.pop_front());
+          }
+          if (__waiters_.empty()) {
+            __state &= ~__waiters_bit;
+          }
+          __state_.store(__state, std::memory_order_release);
+        }
+        __async_wait::__wake_all(__woken);
+      }
+
+      std::atomic<std::size_t> __state_{0};
+      std::atomic<std::size_t> __limit_;
+      std::mutex __mutex_;
+      __async_wait::__waiter_list __waiters_;
+      __update_fn* __update_;
+      std::mutex __update_mutex_;
+    };
+
+    // How `admit` handles an operation that finds no free slot: fail fast, or queue for at most
+    // `__timeout_` as measured on `__sched_`.
+    struct __fail_fast { };
+
+    template <class _Scheduler>
+    struct __queue_for {
+      _Scheduler __sched_;
+      duration_of_t<_Scheduler> __timeout_;
+    };
+
+    template <class _ReceiverId>
+    struct __operation_base {
+      using _Receiver = stdexec::__t<_ReceiverId>;
+
+      void __start_child() noexcept {
+        __start_time_ = __clock::now();
+        __start_child_(this);
+      }
+
+      void __complete(__sample __smpl) noexcept {
+        __limiter_->__complete(__clock::now() - __start_time_, __smpl);
+      }
+
+      __limiter_base* __limiter_;
+      STDEXEC_ATTRIBUTE((no_unique_address)) _Receiver __rcvr_;
+      void (*__start_child_)(__operation_base*) noexcept;
+      __clock::time_point __start_time_{};
+    };
+
+    template <class _ReceiverId>
+    struct __receiver {
+      using _Receiver = stdexec::__t<_ReceiverId>;
+
+      struct __t {
+        using __id = __receiver;
+        using receiver_concept = receiver_t;
+        __operation_base<_ReceiverId>* __op_;
+
+        // The slot is freed before the completion is forwarded, so that it is not held while
+        // the continuation runs.
+        template <class... _As>
+        void set_value(_As&&... __as) noexcept {
+          __op_->__complete(__sample::__succeeded);
+          stdexec::set_value(static_cast<_Receiver&&>(__op_->__rcvr_), static_cast<_As&&>(__as)...);
+        }
+
+        template <class _Error>
+        void set_error(_Error&& __err) noexcept {
+          __op_->__complete(__sample::__dropped);
+          stdexec::set_error(
+            static_cast<_Receiver&&>(__op_->__rcvr_), static_cast<_Error&&>(__err));
+        }
+
+        void set_stopped() noexcept {
+          __op_->__complete(__sample::__ignored);
+          stdexec::set_stopped(static_cast<_Receiver&&>(__op_->__rcvr_));
+        }
+
+        auto get_env() const noexcept -> env_of_t<_Receiver> {
+          return stdexec::get_env(__op_->__rcvr_);
+        }
+      };
+    };
+
+    // The state of an operation that waits for a slot. Two events must happen before the wait
+    // is over: the waiter is resolved, by being handed a slot, by its deadline or by a stop
+    // request, and the deadline timer completes, which it does promptly once the waiter is
+    // resolved because the resolution requests it to stop.
+    template <class _Queue, class _ReceiverId>
+    struct __wait_state {
+      struct __t {
+        __t(__operation_base<_ReceiverId>*, _Queue&) noexcept {
+        }
+      };
+    };
+
+    template <class _Scheduler, class _ReceiverId>
+    struct __wait_state<__queue_for<_Scheduler>, _ReceiverId> {
+      using _Receiver = stdexec::__t<_ReceiverId>;
+
+      enum class __outcome {
+        __admitted,
+        __timed_out,
+        __stopped
+      };
+
+      struct __t;
+
+      struct __timer_rcvr {
+        using receiver_concept = receiver_t;
+        __t* __self_;
+
+        void set_value() noexcept {
+          if (__self_->__op_->__limiter_->__cancel(__self_)) {
+            __self_->__resolve(__outcome::__timed_out);
+          }
+          __self_->__arrive();
+        }
+
+        // Without a timer, the operation waits for a slot for as long as it takes.
+        template <class _Error>
+        void set_error(_Error&&) noexcept {
+          __self_->__arrive();
+        }
+
+        void set_stopped() noexcept {
+          __self_->__arrive();
+        }
+
+        auto get_env() const noexcept -> prop<get_stop_token_t, inplace_stop_token> {
+          return prop{get_stop_token, __self_->__timer_stop_.get_token()};
+        }
+      };
+
+      using __timer_sender_t =
+        __call_result_t<schedule_after_t, _Scheduler&, const duration_of_t<_Scheduler>&>;
+      using __timer_op_t = connect_result_t<__timer_sender_t, __timer_rcvr>;
+      using __stop_token_t = stop_token_of_t<env_of_t<_Receiver>>;
+
+      struct __on_stop_requested {
+        __t* __self_;
+
+        void operator()() const noexcept {
+          if (__self_->__op_->__limiter_->__cancel(__self_)) {
+            __self_->__resolve(__outcome::__stopped);
+          }
+        }
+      };
+
+      using __stop_callback_t = stop_callback_for_t<__stop_token_t, __on_stop_requested>;
+
+      struct __t : __waiter {
+        using __id = __wait_state;
+
+        __t(__operation_base<_ReceiverId>* __op, __queue_for<_Scheduler>& __queue)
+          : __waiter{.__wake_ = &__wake_impl}
+          , __op_(__op)
+          , __timer_op_(stdexec::connect(
+              schedule_after(__queue.__sched_, __queue.__timeout_), __timer_rcvr{this})) {
+        }
+
+        void __wait() noexcept {
+          auto __token = get_stop_token(stdexec::get_env(__op_->__rcvr_));
+          if (__token.stop_requested()) {
+            stdexec::set_stopped(static_cast<_Receiver&&>(__op_->__rcvr_));
+            return;
+          }
+          __on_stop_.emplace(__token, __on_stop_requested{this});
+          switch (__op_->__limiter_->__wait_or_enqueue(this)) {
+          case __wait_result::__ready:
+            __on_stop_.reset();
+            __op_->__start_child();
+            break;
+          case __wait_result::__stopped:
+            __on_stop_.reset();
+            stdexec::set_stopped(static_cast<_Receiver&&>(__op_->__rcvr_));
+            break;
+          case __wait_result::__queued:
+            stdexec::start(__timer_op_);
+            // do not access this
+            break;
+          }
+        }
+
+        // Called once the wait is over on the scheduler of the receiver's environment.
+        void __resumed() noexcept {
+          __op_->__start_child();
+        }
+
+        // Frees the slot the operation was admitted to if it cannot resume on that scheduler.
+        template <class _Tag, class... _As>
+        void __resume_failed(_Tag, _As&&... __as) noexcept {
+          __op_->__complete(__sample::__ignored);
+          _Tag()(static_cast<_Receiver&&>(__op_->__rcvr_), static_cast<_As&&>(__as)...);
+        }
+
+        static constexpr bool __resumes_on_scheduler =
+          __callable<get_scheduler_t, env_of_t<_Receiver>>;
+
+        using __resume_op_t = typename __async_wait::__resume_op<_Receiver, __t>::__t;
+
+        static void __wake_impl(__waiter* __wtr) noexcept {
+          static_cast<__t*>(__wtr)->__resolve(__outcome::__admitted);
+        }
+
+        void __resolve(__outcome __result) noexcept {
+          __outcome_ = __result;
+          __timer_stop_.request_stop();
+          __arrive();
+        }
+
+        void __arrive() noexcept {
+          if (__pending_.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+            return;
+          }
+          __on_stop_.reset();
+          switch (__outcome_) {
+          case __outcome::__admitted:
+            // Do not start the operation on the thread that freed the slot.
+            if constexpr (__resumes_on_scheduler) {
+              stdexec::start(__resume_op_.emplace(__emplace_from{[this] {
+                auto __sched = get_scheduler(stdexec::get_env(__op_->__rcvr_));
+                return stdexec::connect(
+                  stdexec::schedule(__sched), __async_wait::__resume_rcvr<__t>{this});
+              }}));
+            } else {
+              __op_->__start_child();
+            }
+            break;
+          case __outcome::__timed_out:
+            stdexec::set_error(static_cast<_Receiver&&>(__op_->__rcvr_), load_shed_error{});
+            break;
+          case __outcome::__stopped:
+            stdexec::set_stopped(static_cast<_Receiver&&>(__op_->__rcvr_));
+            break;
+          }
+        }
+
+        __operation_base<_ReceiverId>* __op_;
+        __timer_op_t __timer_op_;
+        inplace_stop_source __timer_stop_;
+        stdexec::__optional<__stop_callback_t> __on_stop_;
+        std::atomic<int> __pending_{2};
+        __outcome __outcome_ = __outcome::__admitted;
+        STDEXEC_ATTRIBUTE((no_unique_address)) stdexec::__optional<__resume_op_t> __resume_op_;
+      };
+    };
+
+    template <class _CvrefSenderId, class _ReceiverId, class _Queue>
+    struct __operation {
+      using _CvrefSender = stdexec::__cvref_t<_CvrefSenderId>;
+      using _Receiver = stdexec::__t<_ReceiverId>;
+      using __receiver_t = stdexec::__t<__receiver<_ReceiverId>>;
+
+      struct __t : __operation_base<_ReceiverId> {
+        using __id = __operation;
+
+        __t(_CvrefSender&& __sndr, _Receiver __rcvr, __limiter_base* __limiter, _Queue& __queue)
+          : __operation_base<_ReceiverId>{
+              __limiter, static_cast<_Receiver&&>(__rcvr), &__start_child_impl}
+          , __child_op_(stdexec::connect(static_cast<_CvrefSender&&>(__sndr), __receiver_t{this}))
+          , __wait_(this, __queue) {
+        }
+
+        void start() & noexcept {
+          if (this->__limiter_->__try_admit()) {
+            this->__start_child();
+          } else if constexpr (same_as<_Queue, __fail_fast>) {
+            stdexec::set_error(static_cast<_Receiver&&>(this->__rcvr_), load_shed_error{});
+          } else {
+            __wait_.__wait();
+          }
+        }
+
+       private:
+        static void __start_child_impl(__operation_base<_ReceiverId>* __base) noexcept {
+          stdexec::start(static_cast<__t*>(__base)->__child_op_);
+        }
+
+        connect_result_t<_CvrefSender, __receiver_t> __child_op_;
+        stdexec::__t<__wait_state<_Queue, _ReceiverId>> __wait_;
+      };
+    };
+
+    template <class _SenderId, class _Queue>
+    struct __sender {
+      using _Sender = stdexec::__t<_SenderId>;
+
+      struct __t {
+        using __id = __sender;
+        using sender_concept = sender_t;
+
+        template <class _Self, class _Receiver>
+        using __operation_t = stdexec::__t<
+          __operation<__cvref_id<_Self, _Sender>, stdexec::__id<_Receiver>, _Queue>>;
+
+        template <class _Self, class _Env>
+        using __completions_t = __try_make_completion_signatures<
+          __copy_cvref_t<_Self, _Sender>,
+          _Env,
+          __if_c<
+            same_as<_Queue, __fail_fast>,
+            stdexec::completion_signatures<set_error_t(load_shed_error)>,
+            __async_wait::__with_resume_completions_t<
+              _Env,
+              stdexec::completion_signatures<set_error_t(load_shed_error), set_stopped_t()>>>>;
+
+        template <__decays_to<__t> _Self, receiver _Receiver>
+          requires sender_to<
+            __copy_cvref_t<_Self, _Sender>,
+            stdexec::__t<__receiver<stdexec::__id<_Receiver>>>>
+        static auto connect(_Self&& __self, _Receiver __rcvr) -> __operation_t<_Self, _Receiver> {
+          return {
+            static_cast<_Self&&>(__self).__sndr_,
+            static_cast<_Receiver&&>(__rcvr),
+            __self.__limiter_,
+            __self.__queue_};
+        }
+
+        template <__decays_to<__t> _Self, class _Env>
+        static auto get_completion_signatures(_Self&&, _Env&&) -> __completions_t<_Self, _Env> {
+          return {};
+        }
+
+        auto get_env() const noexcept -> env_of_t<const _Sender&> {
+          return stdexec::get_env(__sndr_);
+        }
+
+        _Sender __sndr_;
+        __limiter_base* __limiter_;
+        STDEXEC_ATTRIBUTE((no_unique_address)) _Queue __queue_;
+      };
+    };
+
+    struct admit_t;
+  } // namespace __admit
+
+  //! Bounds the number of operations in flight that are started through `admit` with it. The
+  //! limit is fixed with `static_limit`, or adapts to the latencies of the admitted operations
+  //! with `aimd_limit` or `gradient_limit`. A limiter must outlive the operations that use it.
+  template <class _Limit = static_limit>
+  class admission_limiter : __admit::__limiter_base {
+   public:
+    explicit admission_limiter(_Limit __limit = {}) noexcept
+      : __admit::__limiter_base(__initial_limit(__limit), __update_fn_for())
+      , __limit_(static_cast<_Limit&&>(__limit)) {
+    }
+
+    admission_limiter(admission_limiter&&) = delete;
+
+    //! The current limit.
+    [[nodiscard]]
+    auto limit() const noexcept -> std::size_t {
+      return this->__limit();
+    }
+
+    //! The number of admitted operations that have not completed yet.
+    [[nodiscard]]
+    auto in_flight() const noexcept -> std::size_t {
+      return this->__in_flight();
+    }
+
+   private:
+    friend struct __admit::admit_t;
+
+    static auto __initial_limit(const _Limit& __limit) noexcept -> std::size_t {
+      if constexpr (stdexec::same_as<_Limit, static_limit>) {
+        return __limit.limit;
+      } else {
+        return __limit.initial_limit;
+      }
+    }
+
+    static auto __update_fn_for() noexcept -> __update_fn* {
+      if constexpr (stdexec::same_as<_Limit, static_limit>) {
+        return nullptr;
+      } else {
+        return &__update_impl;
+      }
+    }
+
+    static auto __update_impl(
+      __admit::__limiter_base* __base,
+      std::size_t __limit,
+      std::size_t __in_flight,
+      __admit::__clock::duration __latency,
+      bool __dropped) noexcept -> std::size_t {
+      auto* __self = static_cast<admission_limiter*>(__base);
+      return __self->__limit_.update(__limit, __in_flight, __latency, __dropped);
+    }
+
+    STDEXEC_ATTRIBUTE((no_unique_address)) _Limit __limit_;
+  };
+
+  namespace __admit {
+    struct admit_t {
+      template <class _Sender, class _Queue>
+      using __sender_t = stdexec::__t<__sender<stdexec::__id<__decay_t<_Sender>>, _Queue>>;
+
+      //! Starts `__sndr` if `__limiter` has a free slot, and otherwise completes with
+      //! `load_shed_error`.
+      template <sender _Sender, class _Limit>
+      auto operator()(_Sender&& __sndr, admission_limiter<_Limit>& __limiter) const
+        -> __sender_t<_Sender, __fail_fast> {
+        return {static_cast<_Sender&&>(__sndr), &__limiter, {}};
+      }
+
+      //! Starts `__sndr` once `__limiter` has a free slot. If none becomes free within
+      //! `__timeout` as measured on `__sched`, completes with `load_shed_error`.
+      template <sender _Sender, class _Limit, timed_scheduler _Scheduler>
+      auto operator()(
+        _Sender&& __sndr,
+        admission_limiter<_Limit>& __limiter,
+        _Scheduler __sched,
+        duration_of_t<_Scheduler> __timeout) const -> __sender_t<_Sender, __queue_for<_Scheduler>> {
+        return {
+          static_cast<_Sender&&>(__sndr),
+          &__limiter,
+          {static_cast<_Scheduler&&>(__sched), __timeout}};
+      }
+
+      template <sender _Sender, class _Limit, class... _Args>
+      auto operator()(
+        _Sender&& __sndr,
+        std::reference_wrapper<admission_limiter<_Limit>> __limiter,
+        _Args&&... __args) const -> decltype(auto) {
+        return (*this)(
+          static_cast<_Sender&&>(__sndr), __limiter.get(), static_cast<_Args&&>(__args)...);
+      }
+
+      template <class _Limit>
+      STDEXEC_ATTRIBUTE((always_inline)) auto operator()(admission_limiter<_Limit>& __limiter) const
+        -> __binder_back<admit_t, std::reference_wrapper<admission_limiter<_Limit>>> {
+        return {{std::ref(__limiter)}, {}, {}};
+      }
+
+      template <class _Limit, timed_scheduler _Scheduler>
+      STDEXEC_ATTRIBUTE((always_inline)) auto operator()(
+        admission_limiter<_Limit>& __limiter,
+        _Scheduler __sched,
+        duration_of_t<_Scheduler> __timeout) const
+        -> __binder_back<
+          admit_t,
+          std::reference_wrapper<admission_limiter<_Limit>>,
+          _Scheduler,
+          duration_of_t<_Scheduler>> {
+        return {{std::ref(__limiter), static_cast<_Scheduler&&>(__sched), __timeout}, {}, {}};
+      }
+    };
+  } // namespace __admit
+
+  //! `admit(sndr, limiter)` starts `sndr` only if `limiter` allows another operation in
+  //! flight, and otherwise completes at once with `load_shed_error`.
+  //! `admit(sndr, limiter, sched, timeout)` instead queues the operation until a slot is free,
+  //! in FIFO order, and sheds it if none is free within `timeout` on the timed scheduler
+  //! `sched`; it completes with `set_stopped()` if stop is requested while it is queued. A
+  //! queued operation that gets a slot starts on the scheduler of its receiver's environment,
+  //! if it has one, rather than on the thread that freed the slot, and frees the slot again
+  //! if that scheduler completes with an error or stopped instead of running it.
+  //!
+  //! The latency of each admitted operation, from its start to its completion, is fed to the
+  //! limiter's limit algorithm; an error counts as a dropped operation and a stopped
+  //! completion is ignored.
+  using __admit::admit_t;
+  inline constexpr admit_t admit{};
+} // namespace exec
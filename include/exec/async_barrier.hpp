@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../stdexec/execution.hpp"
+
+#include "./__detail/__async_wait.hpp"
+
+#include <cstddef>
+#include <mutex>
+
+namespace exec {
+  namespace __barrier {
+    using namespace stdexec;
+    using __async_wait::__wait_result;
+    using __async_wait::__waiter;
+
+    // Arrivals are rare compared to the work between them, so all of them take the lock.
+    class __barrier_base {
+     public:
+      // An arrival cannot be taken back, so waiting for the phase to complete is not
+      // cancellable.
+      static constexpr bool __stoppable = false;
+
+      explicit __barrier_base(std::ptrdiff_t __expected) noexcept
+        : __expected_(__expected)
+        , __pending_(__expected) {
+        STDEXEC_ASSERT(__expected > 0);
+      }
+
+      ~__barrier_base() {
+        STDEXEC_ASSERT(__waiters_.empty());
+      }
+
+      void __arrive(std::ptrdiff_t __dropped) noexcept {
+        __async_wait::__wake_list __woken;
+        {
+          std::lock_guard __lock{__mutex_};
+          __expected_ -= __dropped;
+          __arrive_locked(__woken);
+        }
+        __async_wait::__wake_all(__woken);
+      }
+
+      auto __try_fast(__waiter*) noexcept -> bool {
+        return false;
+      }
+
+      auto __wait_or_enqueue(__waiter* __wtr) noexcept -> __wait_result {
+        __async_wait::__wake_list __woken;
+        {
+          std::lock_guard __lock{__mutex_};
+          if (!__arrive_locked(__woken)) {
+            __waiters_.push_back(__wtr);
+            return __wait_result::__queued;
+          }
+        }
+        __async_wait::__wake_all(__woken);
+        return __wait_result::__ready;
+      }
+
+      auto __cancel(__waiter*) noexcept -> bool {
+        return false;
+      }
+
+      // A woken waiter holds nothing that it could give back.
+      void __give_back(__waiter*) noexcept {
+      }
+
+     private:
+      // Returns true if this arrival completes the phase.
+      auto __arrive_locked(__async_wait::__wake_list& __woken) noexcept -> bool {
+        STDEXEC_ASSERT(__pending_ > 0);
+        if (--__pending_ != 0) {
+          return false;
+        }
+        while (!__waiters_.empty()) {
+          __woken.push_back(__waiters_.pop_front());
+        }
+        __pending_ = __expected_;
+        return true;
+      }
+
+      std::ptrdiff_t __expected_;
+      std::ptrdiff_t __pending_;
+      std::mutex __mutex_;
+      __async_wait::__waiter_list __waiters_;
+    };
+
+    using __sender = __async_wait::__sender<__barrier_base>;
+  } // namespace __barrier
+
+  //! A reusable barrier for asynchronous code, like `std::barrier` without a completion
+  //! function. `arrive_and_wait()` returns a sender that arrives at the barrier when it is
+  //! started and completes with `set_value()` once the current phase has completed. The last
+  //! arrival of a phase completes inline; the others resume on the scheduler of their
+  //! receiver's environment, if it has one.
+  class async_barrier : __barrier::__barrier_base {
+   public:
+    explicit async_barrier(std::ptrdiff_t __expected) noexcept
+      : __barrier::__barrier_base(__expected) {
+    }
+
+    async_barrier(async_barrier&&) = delete;
+
+    [[nodiscard]]
+    auto arrive_and_wait() noexcept -> __barrier::__sender {
+      return __barrier::__sender{this};
+    }
+
+    //! Arrives at the barrier without waiting for the phase to complete.
+    void arrive() noexcept {
+      this->__arrive(0);
+    }
+
+    //! Arrives at the barrier and removes the caller from the participants of later phases.
+    void arrive_and_drop() noexcept {
+      this->__arrive(1);
+    }
+  };
+} // namespace exec
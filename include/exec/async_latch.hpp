@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../stdexec/execution.hpp"
+
+#include "./__detail/__async_wait.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+
+namespace exec {
+  namespace __latch {
+    using namespace stdexec;
+    using __async_wait::__wait_result;
+    using __async_wait::__waiter;
+
+    class __latch_base {
+     public:
+      static constexpr bool __stoppable = true;
+
+      explicit __latch_base(std::ptrdiff_t __expected) noexcept
+        : __count_(__expected) {
+        STDEXEC_ASSERT(__expected >= 0);
+      }
+
+      ~__latch_base() {
+        STDEXEC_ASSERT(__waiters_.empty());
+      }
+
+      void __count_down(std::ptrdiff_t __n) noexcept {
+        const std::ptrdiff_t __old = __count_.fetch_sub(__n, std::memory_order_acq_rel);
+        STDEXEC_ASSERT(__old >= __n);
+        if (__old != __n) {
+          return;
+        }
+        __async_wait::__wake_list __woken;
+        {
+          std::lock_guard __lock{__mutex_};
+          while (!__waiters_.empty()) {
+            __woken.push_back(__waiters_.pop_front());
+          }
+        }
+        __async_wait::__wake_all(__woken);
+      }
+
+      auto __try_wait() const noexcept -> bool {
+        return __count_.load(std::memory_order_acquire) == 0;
+      }
+
+      auto __try_fast(__waiter*) noexcept -> bool {
+        return __try_wait();
+      }
+
+      auto __wait_or_enqueue(__waiter* __wtr) noexcept -> __wait_result {
+        std::lock_guard __lock{__mutex_};
+        if (__wtr->__stop_requested_) {
+          return __wait_result::__stopped;
+        }
+        // The thread that counts down to zero takes the lock before waking the waiters.
+        if (__try_wait()) {
+          return __wait_result::__ready;
+        }
+        __waiters_.push_back(__wtr);
+        return __wait_result::__queued;
+      }
+
+      auto __cancel(__waiter* __wtr) noexcept -> bool {
+        std::lock_guard __lock{__mutex_};
+        return __waiters_.__try_remove(__wtr);
+      }
+
+      // A woken waiter holds nothing that it could give back.
+      void __give_back(__waiter*) noexcept {
+      }
+
+     private:
+      std::atomic<std::ptrdiff_t> __count_;
+      std::mutex __mutex_;
+      __async_wait::__waiter_list __waiters_;
+    };
+
+    using __sender = __async_wait::__sender<__latch_base>;
+  } // namespace __latch
+
+  //! A single-use countdown for asynchronous code, like `std::latch`. `wait()` returns a
+  //! sender that completes with `set_value()` once the counter has reached zero, and with
+  //! `set_stopped()` if stop is requested on the receiver's stop token while it is waiting.
+  //! Waiters that are released by `count_down` resume on the scheduler of their receiver's
+  //! environment, if it has one, rather than on the thread that counted down.
+  class async_latch : __latch::__latch_base {
+   public:
+    explicit async_latch(std::ptrdiff_t __expected) noexcept
+      : __latch::__latch_base(__expected) {
+    }
+
+    async_latch(async_latch&&) = delete;
+
+    void count_down(std::ptrdiff_t __n = 1) noexcept {
+      this->__count_down(__n);
+    }
+
+    [[nodiscard]]
+    auto try_wait() const noexcept -> bool {
+      return this->__try_wait();
+    }
+
+    [[nodiscard]]
+    auto wait() noexcept -> __latch::__sender {
+      return __latch::__sender{this};
+    }
+  };
+} // namespace exec
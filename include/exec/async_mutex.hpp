@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "async_semaphore.hpp"
+
+namespace exec {
+  //! A mutex for asynchronous code. `lock()` returns a sender that completes with `set_value()`
+  //! once the mutex has been acquired, and with `set_stopped()` if stop is requested on the
+  //! receiver's stop token while it is waiting. The mutex is handed to waiters in FIFO order,
+  //! and a waiter that is handed the mutex by another thread resumes on the scheduler of its
+  //! receiver's environment, if it has one; if that scheduler completes with an error or
+  //! stopped instead, the waiter unlocks the mutex again and completes the same way. It is not
+  //! recursive, and `unlock()` may be called from any thread.
+  //!
+  //! Waiting operations are queued in their operation states, so waiting does not allocate.
+  //! Locking and unlocking take no lock unless an operation is waiting.
+  class async_mutex : __sem::__semaphore_base {
+   public:
+    async_mutex() noexcept
+      : __sem::__semaphore_base(1) {
+    }
+
+    async_mutex(async_mutex&&) = delete;
+
+    [[nodiscard]]
+    auto lock() noexcept -> __sem::__sender {
+      return __sem::__sender{this};
+    }
+
+    [[nodiscard]]
+    auto try_lock() noexcept -> bool {
+      return this->__try_acquire();
+    }
+
+    void unlock() noexcept {
+      this->__release(1);
+    }
+  };
+} // namespace exec
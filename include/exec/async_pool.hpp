@@ -0,0 +1,384 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../stdexec/execution.hpp"
+#include "../stdexec/__detail/__optional.hpp"
+
+#include "./__detail/__numa.hpp"
+#include "async_semaphore.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace exec {
+  namespace __pool {
+    using namespace stdexec;
+
+    template <class _Ty>
+    struct __slot {
+      stdexec::__optional<_Ty> __value_;
+      std::atomic<std::uint32_t> __next_{0};
+    };
+
+    // The objects of one NUMA node. A permit of `__sem_` stands for an object on the free list,
+    // so an acquirer that holds a permit always finds one. The free list is a lock-free stack of
+    // slot indices; its head carries a tag that is bumped on every update to rule out ABA.
+    template <class _Ty>
+    class __sub_pool {
+     public:
+      template <class _Factory>
+      __sub_pool(std::size_t __size, int __node, _Factory& __factory)
+        : __sem_(__size)
+        , __node_(__node)
+        , __size_(__size) {
+        numa_allocator<__slot<_Ty>> __alloc{__node_};
+        __slots_ = __alloc.allocate(__size_);
+        std::size_t __constructed = 0;
+        try {
+          for (; __constructed < __size_; ++__constructed) {
+            __slot<_Ty>* __slt = ::new (&__slots_[__constructed]) __slot<_Ty>{};
+            __slt->__value_.emplace(__emplace_from{[&] { return __make(__factory); }});
+          }
+        } catch (...) {
+          __destroy(__constructed + 1);
+          throw;
+        }
+        for (std::size_t __i = __size_; __i != 0; --__i) {
+          __push(static_cast<std::uint32_t>(__i - 1));
+        }
+      }
+
+      __sub_pool(__sub_pool&&) = delete;
+
+      ~__sub_pool() {
+        __destroy(__size_);
+      }
+
+      [[nodiscard]]
+      auto __size() const noexcept -> std::size_t {
+        return __size_;
+      }
+
+      auto __value(std::uint32_t __index) noexcept -> _Ty& {
+        return *__slots_[__index].__value_;
+      }
+
+      // Must only be called with a permit of `__sem_`.
+      auto __pop() noexcept -> std::uint32_t {
+        std::uint64_t __head = __head_.load(std::memory_order_acquire);
+        for (;;) {
+          const auto __top = static_cast<std::uint32_t>(__head);
+          STDEXEC_ASSERT(__top != 0);
+          const std::uint32_t __next = __slots_[__top - 1].__next_.load(std::memory_order_relaxed);
+          if (__head_.compare_exchange_weak(
+                __head, __bump(__head, __next), std::memory_order_acquire,
+                std::memory_order_acquire)) {
+            return __top - 1;
+          }
+        }
+      }
+
+      void __push(std::uint32_t __index) noexcept {
+        std::uint64_t __head = __head_.load(std::memory_order_relaxed);
+        do {
+          __slots_[__index].__next_.store(
+            static_cast<std::uint32_t>(__head), std::memory_order_relaxed);
+        } while (!__head_.compare_exchange_weak(
+          __head, __bump(__head, __index + 1), std::memory_order_release,
+          std::memory_order_relaxed));
+      }
+
+      async_semaphore __sem_;
+
+     private:
+      template <class _Factory>
+      auto __make(_Factory& __factory) -> _Ty {
+        if constexpr (__callable<_Factory&, int>) {
+          return __factory(__node_);
+        } else {
+          return __factory();
+        }
+      }
+
+      void __destroy(std::size_t __count) noexcept {
+        for (std::size_t __i = 0; __i < __count; ++__i) {
+          std::destroy_at(&__slots_[__i]);
+        }
+        numa_allocator<__slot<_Ty>> __alloc{__node_};
+        __alloc.deallocate(__slots_, __size_);
+      }
+
+      // The low half of the head is one plus the index of the top slot, or zero if the list
+      // is empty. The high half is the tag.
+      static auto __bump(std::uint64_t __head, std::uint32_t __top) noexcept -> std::uint64_t {
+        return (((__head >> 32) + 1) << 32) | __top;
+      }
+
+      int __node_;
+      std::size_t __size_;
+      __slot<_Ty>* __slots_ = nullptr;
+      std::atomic<std::uint64_t> __head_{0};
+    };
+
+    template <class _Ty>
+    class __lease {
+     public:
+      __lease() noexcept = default;
+
+      __lease(__sub_pool<_Ty>* __pool, std::uint32_t __index) noexcept
+        : __pool_(__pool)
+        , __index_(__index) {
+      }
+
+      __lease(__lease&& __other) noexcept
+        : __pool_(std::exchange(__other.__pool_, nullptr))
+        , __index_(__other.__index_) {
+      }
+
+      auto operator=(__lease __other) noexcept -> __lease& {
+        std::swap(__pool_, __other.__pool_);
+        std::swap(__index_, __other.__index_);
+        return *this;
+      }
+
+      ~__lease() {
+        reset();
+      }
+
+      //! Returns the object to the pool early.
+      void reset() noexcept {
+        if (__sub_pool<_Ty>* __pool = std::exchange(__pool_, nullptr)) {
+          __pool->__push(__index_);
+          __pool->__sem_.release();
+        }
+      }
+
+      [[nodiscard]]
+      auto get() const noexcept -> _Ty* {
+        return __pool_ ? &__pool_->__value(__index_) : nullptr;
+      }
+
+      auto operator*() const noexcept -> _Ty& {
+        STDEXEC_ASSERT(__pool_ != nullptr);
+        return __pool_->__value(__index_);
+      }
+
+      auto operator->() const noexcept -> _Ty* {
+        return get();
+      }
+
+      explicit operator bool() const noexcept {
+        return __pool_ != nullptr;
+      }
+
+     private:
+      __sub_pool<_Ty>* __pool_ = nullptr;
+      std::uint32_t __index_ = 0;
+    };
+
+    template <class _Ty>
+    class __pool_base {
+     public:
+      template <class _Factory>
+      __pool_base(std::size_t __capacity, _Factory& __factory, const numa_policy& __policy) {
+        const std::size_t __num_nodes = __policy.num_nodes() == 0 ? 1 : __policy.num_nodes();
+        __sub_pools_.reserve(__num_nodes);
+        for (std::size_t __node = 0; __node < __num_nodes; ++__node) {
+          const std::size_t __size = __capacity / __num_nodes
+                                   + (__node < __capacity % __num_nodes ? 1 : 0);
+          __sub_pools_.push_back(
+            std::make_unique<__sub_pool<_Ty>>(__size, static_cast<int>(__node), __factory));
+        }
+      }
+
+      // Takes an object that is available right away, preferring the current node.
+      auto __try_acquire() noexcept -> __lease<_Ty> {
+        const std::size_t __num_nodes = __sub_pools_.size();
+        const std::size_t __local = __local_index();
+        for (std::size_t __i = 0; __i < __num_nodes; ++__i) {
+          __sub_pool<_Ty>* __pool = __sub_pools_[(__local + __i) % __num_nodes].get();
+          if (__pool->__sem_.try_acquire()) {
+            return {__pool, __pool->__pop()};
+          }
+        }
+        return {};
+      }
+
+      // The sub-pool to wait on when none has an object available.
+      auto __waiting_pool() noexcept -> __sub_pool<_Ty>* {
+        const std::size_t __num_nodes = __sub_pools_.size();
+        const std::size_t __local = __local_index();
+        for (std::size_t __i = 0; __i < __num_nodes; ++__i) {
+          __sub_pool<_Ty>* __pool = __sub_pools_[(__local + __i) % __num_nodes].get();
+          if (__pool->__size() != 0) {
+            return __pool;
+          }
+        }
+        return __sub_pools_[__local].get();
+      }
+
+     private:
+      auto __local_index() const noexcept -> std::size_t {
+        const int __node = exec::_get_current_numa_node();
+        return __node < 0 ? 0 : static_cast<std::size_t>(__node) % __sub_pools_.size();
+      }
+
+      std::vector<std::unique_ptr<__sub_pool<_Ty>>> __sub_pools_;
+    };
+
+    template <class _Ty, class _ReceiverId>
+    struct __operation {
+      using _Receiver = stdexec::__t<_ReceiverId>;
+
+      struct __t {
+        using __id = __operation;
+
+        struct __acquired_rcvr {
+          using receiver_concept = receiver_t;
+          __t* __op_;
+
+          void set_value() noexcept {
+            __sub_pool<_Ty>* __pool = __op_->__waiting_pool_;
+            stdexec::set_value(
+              static_cast<_Receiver&&>(__op_->__rcvr_), __lease<_Ty>{__pool, __pool->__pop()});
+          }
+
+          // The semaphore has taken the permit back if the waiter failed to resume.
+          template <class _Error>
+          void set_error(_Error&& __err) noexcept {
+            stdexec::set_error(
+              static_cast<_Receiver&&>(__op_->__rcvr_), static_cast<_Error&&>(__err));
+          }
+
+          void set_stopped() noexcept {
+            stdexec::set_stopped(static_cast<_Receiver&&>(__op_->__rcvr_));
+          }
+
+          auto get_env() const noexcept -> env_of_t<_Receiver> {
+            return stdexec::get_env(__op_->__rcvr_);
+          }
+        };
+
+        using __acquire_op_t = connect_result_t<__sem::__sender, __acquired_rcvr>;
+
+        __t(__pool_base<_Ty>* __pool, _Receiver __rcvr)
+          noexcept(__nothrow_move_constructible<_Receiver>)
+          : __pool_(__pool)
+          , __rcvr_(static_cast<_Receiver&&>(__rcvr)) {
+        }
+
+        void start() & noexcept {
+          if (__lease<_Ty> __lse = __pool_->__try_acquire()) {
+            stdexec::set_value(static_cast<_Receiver&&>(__rcvr_), std::move(__lse));
+            return;
+          }
+          __waiting_pool_ = __pool_->__waiting_pool();
+          stdexec::start(__acquire_op_.emplace(__emplace_from{[this] {
+            return stdexec::connect(__waiting_pool_->__sem_.acquire(), __acquired_rcvr{this});
+          }}));
+        }
+
+       private:
+        __pool_base<_Ty>* __pool_;
+        __sub_pool<_Ty>* __waiting_pool_ = nullptr;
+        STDEXEC_ATTRIBUTE((no_unique_address)) _Receiver __rcvr_;
+        stdexec::__optional<__acquire_op_t> __acquire_op_;
+      };
+    };
+
+    template <class _Ty>
+    struct __sender {
+      using sender_concept = sender_t;
+
+      template <class _Env>
+      using __completions_t = __async_wait::__with_resume_completions_t<
+        _Env,
+        stdexec::completion_signatures<set_value_t(__lease<_Ty>), set_stopped_t()>>;
+
+      template <class _Receiver>
+      using __operation_t = stdexec::__t<__operation<_Ty, __id<__decay_t<_Receiver>>>>;
+
+      template <receiver _Receiver>
+        requires receiver_of<_Receiver, __completions_t<env_of_t<_Receiver>>>
+      auto connect(_Receiver __rcvr) const noexcept(__nothrow_move_constructible<_Receiver>)
+        -> __operation_t<_Receiver> {
+        return {__pool_, static_cast<_Receiver&&>(__rcvr)};
+      }
+
+      template <class _Env>
+      static auto get_completion_signatures(const __sender&, _Env&&) -> __completions_t<_Env> {
+        return {};
+      }
+
+      __pool_base<_Ty>* __pool_;
+    };
+  } // namespace __pool
+
+  //! A bounded pool of reusable objects, such as connections, buffers or parsers, for
+  //! asynchronous code. `acquire()` returns a sender that completes with a `lease` once an
+  //! object is available, and with `set_stopped()` if stop is requested on the receiver's stop
+  //! token while it is waiting. The object goes back to the pool when the lease is destroyed
+  //! or reset.
+  //!
+  //! Waiters are queued in their operation states and served in FIFO order; a waiter that is
+  //! handed an object by another thread resumes on the scheduler of its receiver's
+  //! environment, if it has one. If it cannot resume there, the object stays in the pool and
+  //! the waiter completes with the error or stopped of that scheduler. Taking and returning an
+  //! object take no lock while no one is waiting.
+  //!
+  //! Given a NUMA policy, the pool splits its objects across the policy's nodes. An object is
+  //! created by calling the factory with the node index, if it accepts one, and it lives in
+  //! memory allocated on that node. Acquirers prefer the node of the thread they run on and
+  //! take objects from other nodes only if they are available right away; otherwise they wait
+  //! for an object of their own node.
+  template <class _Ty>
+  class async_pool : __pool::__pool_base<_Ty> {
+   public:
+    using lease = __pool::__lease<_Ty>;
+
+    template <class _Factory>
+      requires stdexec::__callable<_Factory&> || stdexec::__callable<_Factory&, int>
+    async_pool(std::size_t __capacity, _Factory __factory)
+      : async_pool(__capacity, static_cast<_Factory&&>(__factory), no_numa_policy{}) {
+    }
+
+    template <class _Factory>
+      requires stdexec::__callable<_Factory&> || stdexec::__callable<_Factory&, int>
+    async_pool(std::size_t __capacity, _Factory __factory, const numa_policy& __policy)
+      : __pool::__pool_base<_Ty>(__capacity, __factory, __policy) {
+    }
+
+    async_pool(async_pool&&) = delete;
+
+    [[nodiscard]]
+    auto acquire() noexcept -> __pool::__sender<_Ty> {
+      return __pool::__sender<_Ty>{this};
+    }
+
+    //! Returns an empty lease if no object is available right away.
+    [[nodiscard]]
+    auto try_acquire() noexcept -> lease {
+      return this->__try_acquire();
+    }
+  };
+} // namespace exec
@@ -17,10 +17,13 @@
 
 #include "../stdexec/execution.hpp"
 #include "../stdexec/stop_token.hpp"
+#include "../stdexec/__detail/__allocator.hpp"
 #include "../stdexec/__detail/__intrusive_queue.hpp"
 #include "../stdexec/__detail/__optional.hpp"
 #include "env.hpp"
 
+#include <atomic>
+#include <cstdint>
 #include <mutex>
 
 namespace exec {
@@ -273,17 +276,17 @@ namespace exec {
 
     ////////////////////////////////////////////////////////////////////////////
     // async_scope::spawn_future implementation
-    enum class __future_step {
-      __invalid = 0,
-      __created,
-      __future,
-      __no_future,
-      __deleted
-    };
-
     template <class _Sender, class _Env>
     struct __future_state;
 
+    // Destroys a future state with the allocator it was allocated with.
+    struct __future_state_delete {
+      template <class _State>
+      void operator()(_State* __state) const noexcept {
+        __state->__delete_(__state);
+      }
+    };
+
     struct __forward_stopped {
       inplace_stop_source* __stop_source_;
 
@@ -298,8 +301,22 @@ namespace exec {
       void __complete() noexcept {
         __complete_(this);
       }
+    };
 
-      __subscription* __next_ = nullptr;
+    // The result of a spawned operation is handed to the consumer of its future through a single
+    // atomic word that is written once by each side:
+    //
+    //  - __pending: neither the operation has completed nor has the consumer shown up.
+    //  - the address of a __subscription: the consumer has started and is waiting.
+    //  - __ready: the operation has completed and its result is stored in the future state.
+    //  - __abandoned: the future, or the operation it was connected to, was destroyed without
+    //    being started.
+    //
+    // Whichever side moves the word second completes the consumer or deletes the future state.
+    enum __handoff : std::uintptr_t {
+      __pending = 0,
+      __ready = 1,
+      __abandoned = 2
     };
 
     template <class _SenderId, class _EnvId, class _ReceiverId>
@@ -312,48 +329,32 @@ namespace exec {
         using __forward_consumer =
           typename stop_token_of_t<env_of_t<_Receiver>>::template callback_type<__forward_stopped>;
 
+        // Called once the result is ready. Takes ownership of the future state.
         void __complete_() noexcept {
-          try {
-            __forward_consumer_.reset();
-            auto __state = std::move(__state_);
-            STDEXEC_ASSERT(__state != nullptr);
-            std::unique_lock __guard{__state->__mutex_};
-            // either the future is still in use or it has passed ownership to __state->__no_future_
-            if (
-              __state->__no_future_.get() != nullptr
-              || __state->__step_ != __future_step::__future) {
-              // invalid state - there is a code bug in the state machine
-              std::terminate();
-            } else if (get_stop_token(get_env(__rcvr_)).stop_requested()) {
-
-              __guard.unlock();
-              stdexec::set_stopped(static_cast<_Receiver&&>(__rcvr_));
-              __guard.lock();
-            } else {
-              std::visit(
-                [this, &__guard]<class _Tup>(_Tup& __tup) {
-                  if constexpr (same_as<_Tup, std::monostate>) {
-                    std::terminate();
-                  } else {
-                    std::apply(
-                      [this, &__guard]<class... _As>(auto tag, _As&... __as) {
-                        __guard.unlock();
-                        tag(static_cast<_Receiver&&>(__rcvr_), static_cast<_As&&>(__as)...);
-                        __guard.lock();
-                      },
-                      __tup);
-                  }
-                },
-                __state->__data_);
-            }
-          } catch (...) {
-
-            stdexec::set_error(static_cast<_Receiver&&>(__rcvr_), std::current_exception());
+          __forward_consumer_.reset();
+          auto __state = std::move(__state_);
+          STDEXEC_ASSERT(__state != nullptr);
+          if (get_stop_token(get_env(__rcvr_)).stop_requested()) {
+            stdexec::set_stopped(static_cast<_Receiver&&>(__rcvr_));
+          } else {
+            std::visit(
+              [this]<class _Tup>(_Tup& __tup) {
+                if constexpr (same_as<_Tup, std::monostate>) {
+                  std::terminate();
+                } else {
+                  std::apply(
+                    [this]<class... _As>(auto tag, _As&... __as) {
+                      tag(static_cast<_Receiver&&>(__rcvr_), static_cast<_As&&>(__as)...);
+                    },
+                    __tup);
+                }
+              },
+              __state->__data_);
           }
         }
 
         STDEXEC_ATTRIBUTE((no_unique_address)) _Receiver __rcvr_;
-        std::unique_ptr<__future_state<_Sender, _Env>> __state_;
+        std::unique_ptr<__future_state<_Sender, _Env>, __future_state_delete> __state_;
         STDEXEC_ATTRIBUTE((no_unique_address)) stdexec::__optional<__forward_consumer> __forward_consumer_;
 
        public:
@@ -361,22 +362,16 @@ namespace exec {
 
         ~__t() noexcept {
           if (__state_ != nullptr) {
-            auto __raw_state = __state_.get();
-            std::unique_lock __guard{__raw_state->__mutex_};
-            if (__raw_state->__data_.index() > 0) {
-              // completed given sender
-              // state is no longer needed
-              return;
-            }
-            __raw_state->__no_future_ = std::move(__state_);
-            __raw_state->__step_from_to_(
-              __guard, __future_step::__future, __future_step::__no_future);
+            // The operation was never started. Unregister from the state's stop source before
+            // the state can be deleted.
+            __forward_consumer_.reset();
+            __state_.release()->__abandon();
           }
         }
 
         template <class _Receiver2>
         explicit __t(
-          _Receiver2&& __rcvr, std::unique_ptr<__future_state<_Sender, _Env>> __state)
+          _Receiver2&& __rcvr, std::unique_ptr<__future_state<_Sender, _Env>, __future_state_delete> __state)
           : __subscription{{},
             [](__subscription* __self) noexcept -> void {
                 static_cast<__t*>(__self)->__complete_();
@@ -388,18 +383,15 @@ namespace exec {
         }
 
         void start() & noexcept {
-          try {
-            if (!!__state_) {
-              std::unique_lock __guard{__state_->__mutex_};
-              if (__state_->__data_.index() != 0) {
-                __guard.unlock();
-                __complete_();
-              } else {
-                __state_->__subscribers_.push_back(this);
-              }
+          if (!!__state_) {
+            auto __expected = static_cast<std::uintptr_t>(__pending);
+            const auto __self = reinterpret_cast<std::uintptr_t>(static_cast<__subscription*>(this));
+            if (!__state_->__handoff_.compare_exchange_strong(
+                  __expected, __self, std::memory_order_acq_rel, std::memory_order_acquire)) {
+              // The result is already there.
+              STDEXEC_ASSERT(__expected == __ready);
+              __complete_();
             }
-          } catch (...) {
-            stdexec::set_error(static_cast<_Receiver&&>(__rcvr_), std::current_exception());
           }
         }
       };
@@ -447,68 +439,30 @@ namespace exec {
         __mtransform<__q<__completion_as_tuple_t>, __mbind_front_q<std::variant, std::monostate>>,
         _Completions>;
 
-    template <class _Ty>
-    struct __dynamic_delete {
-      __dynamic_delete()
-        : __delete_([](_Ty* __p) { delete __p; }) {
-      }
-
-      template <class _Uy>
-        requires convertible_to<_Uy*, _Ty*>
-      __dynamic_delete(std::default_delete<_Uy>)
-        : __delete_([](_Ty* __p) { delete static_cast<_Uy*>(__p); }) {
-      }
-
-      template <class _Uy>
-        requires convertible_to<_Uy*, _Ty*>
-      auto operator=(std::default_delete<_Uy> __d) -> __dynamic_delete& {
-        __delete_ = __dynamic_delete{__d}.__delete_;
-        return *this;
-      }
-
-      void operator()(_Ty* __p) {
-        __delete_(__p);
-      }
-
-      void (*__delete_)(_Ty*);
-    };
-
     template <class _Completions, class _Env>
     struct __future_state_base {
-      __future_state_base(_Env __env, const __impl* __scope)
-        : __forward_scope_{std::in_place, __scope->__stop_source_.get_token(), __forward_stopped{&__stop_source_}}
+      using __delete_fn = void(__future_state_base*) noexcept;
+
+      __future_state_base(__delete_fn* __delete, _Env __env, const __impl* __scope)
+        : __delete_(__delete)
+        , __forward_scope_{std::in_place, __scope->__stop_source_.get_token(), __forward_stopped{&__stop_source_}}
         , __env_(make_env(
             static_cast<_Env&&>(__env),
             stdexec::prop{get_stop_token, __scope->__stop_source_.get_token()})) {
       }
 
-      ~__future_state_base() {
-        std::unique_lock __guard{__mutex_};
-        if (__step_ == __future_step::__created) {
-          // exception during connect() will end up here
-          __step_from_to_(__guard, __future_step::__created, __future_step::__deleted);
-        } else if (__step_ != __future_step::__deleted) {
-          // completing the given sender before the future is dropped will end here
-          __step_from_to_(__guard, __future_step::__future, __future_step::__deleted);
+      // Called by the consumer that gives up on the result without having subscribed to it.
+      void __abandon() noexcept {
+        if (__handoff_.exchange(__abandoned, std::memory_order_acq_rel) == __ready) {
+          __delete_(this);
         }
       }
 
-      void __step_from_to_(
-        std::unique_lock<std::mutex>& __guard,
-        __future_step __from,
-        __future_step __to) {
-        STDEXEC_ASSERT(__guard.owns_lock());
-        auto actual = std::exchange(__step_, __to);
-        STDEXEC_ASSERT(actual == __from);
-      }
-
+      __delete_fn* __delete_;
       inplace_stop_source __stop_source_;
       stdexec::__optional<inplace_stop_callback<__forward_stopped>> __forward_scope_;
-      std::mutex __mutex_;
-      __future_step __step_ = __future_step::__created;
-      std::unique_ptr<__future_state_base, __dynamic_delete<__future_state_base>> __no_future_;
+      std::atomic<std::uintptr_t> __handoff_{__pending};
       __completions_as_variant<_Completions> __data_;
-      __intrusive_queue<&__subscription::__next_> __subscribers_;
       __env_t<_Env> __env_;
     };
 
@@ -522,22 +476,16 @@ namespace exec {
         __future_state_base<_Completions, _Env>* __state_;
         const __impl* __scope_;
 
-        void __dispatch_result_(std::unique_lock<std::mutex>& __guard) noexcept {
+        void __dispatch_result_() noexcept {
           auto& __state = *__state_;
-          auto __local_subscribers = std::move(__state.__subscribers_);
           __state.__forward_scope_.reset();
-          if (__state.__no_future_.get() != nullptr) {
+          const std::uintptr_t __prev = __state.__handoff_.exchange(
+            __ready, std::memory_order_acq_rel);
+          if (__prev == __abandoned) {
             // nobody is waiting for the results
-            // delete this and return
-            __state.__step_from_to_(__guard, __future_step::__no_future, __future_step::__deleted);
-            __guard.unlock();
-            __state.__no_future_.reset();
-            return;
-          }
-          __guard.unlock();
-          while (!__local_subscribers.empty()) {
-            auto* __sub = __local_subscribers.pop_front();
-            __sub->__complete();
+            __state.__delete_(&__state);
+          } else if (__prev != __pending) {
+            reinterpret_cast<__subscription*>(__prev)->__complete();
           }
         }
 
@@ -555,25 +503,19 @@ namespace exec {
 
         template <__movable_value... _As>
         void set_value(_As&&... __as) noexcept {
-          auto& __state = *__state_;
-          std::unique_lock __guard{__state.__mutex_};
           __save_completion(set_value_t(), static_cast<_As&&>(__as)...);
-          __dispatch_result_(__guard);
+          __dispatch_result_();
         }
 
         template <__movable_value _Error>
         void set_error(_Error&& __err) noexcept {
-          auto& __state = *__state_;
-          std::unique_lock __guard{__state.__mutex_};
           __save_completion(set_error_t(), static_cast<_Error&&>(__err));
-          __dispatch_result_(__guard);
+          __dispatch_result_();
         }
 
         void set_stopped() noexcept {
-          auto& __state = *__state_;
-          std::unique_lock __guard{__state.__mutex_};
           __save_completion(set_stopped_t());
-          __dispatch_result_(__guard);
+          __dispatch_result_();
         }
 
         auto get_env() const noexcept -> const __env_t<_Env>& {
@@ -591,13 +533,23 @@ namespace exec {
       using _Completions = __future_completions_t<_Sender, _Env>;
 
       __future_state(_Sender __sndr, _Env __env, const __impl* __scope)
-        : __future_state_base<_Completions, _Env>(static_cast<_Env&&>(__env), __scope)
+        : __future_state_base<_Completions, _Env>(
+            &__delete_impl,
+            static_cast<_Env&&>(__env),
+            __scope)
         , __op_(
             stdexec::connect(
               static_cast<_Sender&&>(__sndr),
               __future_receiver_t<_Sender, _Env>{this, __scope})) {
       }
 
+      static void __delete_impl(__future_state_base<_Completions, _Env>* __base) noexcept {
+        auto* __self = static_cast<__future_state*>(__base);
+        // The allocator is a copy, so it survives the destruction of __env_.
+        auto __alloc = stdexec::__get_env_allocator(__self->__env_);
+        stdexec::__allocate_delete(__alloc, __self);
+      }
+
       connect_result_t<_Sender, __future_receiver_t<_Sender, _Env>> __op_;
     };
 
@@ -623,16 +575,7 @@ namespace exec {
 
         ~__t() noexcept {
           if (__state_ != nullptr) {
-            auto __raw_state = __state_.get();
-            std::unique_lock __guard{__raw_state->__mutex_};
-            if (__raw_state->__data_.index() != 0) {
-              // completed given sender
-              // state is no longer needed
-              return;
-            }
-            __raw_state->__no_future_ = std::move(__state_);
-            __raw_state->__step_from_to_(
-              __guard, __future_step::__future, __future_step::__no_future);
+            __state_.release()->__abandon();
           }
         }
 
@@ -651,13 +594,11 @@ namespace exec {
        private:
         friend struct async_scope;
 
-        explicit __t(std::unique_ptr<__future_state<_Sender, _Env>> __state) noexcept
+        explicit __t(std::unique_ptr<__future_state<_Sender, _Env>, __future_state_delete> __state) noexcept
           : __state_(std::move(__state)) {
-          std::unique_lock __guard{__state_->__mutex_};
-          __state_->__step_from_to_(__guard, __future_step::__created, __future_step::__future);
         }
 
-        std::unique_ptr<__future_state<_Sender, _Env>> __state_;
+        std::unique_ptr<__future_state<_Sender, _Env>, __future_state_delete> __state_;
       };
     };
 
@@ -686,7 +627,7 @@ namespace exec {
     struct __spawn_op_base {
       using _Env = stdexec::__t<_EnvId>;
       __spawn_env_t<_Env> __env_;
-      void (*__delete_)(__spawn_op_base*);
+      void (*__delete_)(__spawn_op_base*) noexcept;
     };
 
     template <class _EnvId>
@@ -731,8 +672,10 @@ namespace exec {
         __t(_Sndr&& __sndr, _Env __env, const __impl* __scope)
           : __spawn_op_base<_EnvId>{__env::__join(static_cast<_Env&&>(__env),
             __spawn_env_{__scope->__stop_source_.get_token()}),
-            [](__spawn_op_base<_EnvId>* __op) {
-                delete static_cast<__t*>(__op);
+            [](__spawn_op_base<_EnvId>* __op) noexcept {
+                // The allocator is a copy, so it survives the destruction of __env_.
+                auto __alloc = stdexec::__get_env_allocator(__op->__env_);
+                stdexec::__allocate_delete(__alloc, static_cast<__t*>(__op));
             }}
           , __op_(stdexec::connect(static_cast<_Sndr&&>(__sndr), __spawn_receiver_t<_Env>{this})) {
         }
@@ -780,15 +723,17 @@ namespace exec {
         // start is noexcept so we can assume that the operation will complete
         // after this, which means we can rely on its self-ownership to ensure
         // that it is eventually deleted
-        stdexec::start(*(
-          new __op_t{nest(static_cast<_Sender&&>(__sndr)), static_cast<_Env&&>(__env), &__impl_}));
+        auto __alloc = stdexec::__get_env_allocator(__env);
+        stdexec::start(*stdexec::__allocate_new<__op_t>(
+          __alloc, nest(static_cast<_Sender&&>(__sndr)), static_cast<_Env&&>(__env), &__impl_));
       }
 
       template <__movable_value _Env = empty_env, sender_in<__env_t<_Env>> _Sender>
       auto spawn_future(_Sender&& __sndr, _Env __env = {}) -> __future_t<_Sender, _Env> {
         using __state_t = __future_state<nest_result_t<_Sender>, _Env>;
-        auto __state = std::make_unique<__state_t>(
-          nest(static_cast<_Sender&&>(__sndr)), static_cast<_Env&&>(__env), &__impl_);
+        auto __alloc = stdexec::__get_env_allocator(__env);
+        std::unique_ptr<__state_t, __future_state_delete> __state{stdexec::__allocate_new<__state_t>(
+          __alloc, nest(static_cast<_Sender&&>(__sndr)), static_cast<_Env&&>(__env), &__impl_)};
         stdexec::start(__state->__op_);
         return __future_t<_Sender, _Env>{std::move(__state)};
       }
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../stdexec/execution.hpp"
+
+#include "./__detail/__async_wait.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+
+namespace exec {
+  namespace __sem {
+    using namespace stdexec;
+    using __async_wait::__wait_result;
+    using __async_wait::__waiter;
+
+    // The part of a semaphore that does not depend on the receivers of its waiters.
+    //
+    // `__state_` holds the number of available permits shifted left by one, and a low bit that
+    // is set while the queue of waiters is non-empty. The uncontended paths are a single CAS on
+    // `__state_`. While the bit is set, no permits are available and neither acquiring nor
+    // releasing may touch `__state_` without holding `__mutex_`: a release hands its permit
+    // directly to the waiter at the front of the queue, which keeps the semaphore fair.
+    class __semaphore_base {
+      static constexpr std::size_t __waiters_bit = 1;
+      static constexpr std::size_t __one_permit = 2;
+
+     public:
+      static constexpr bool __stoppable = true;
+
+      explicit __semaphore_base(std::size_t __permits) noexcept
+        : __state_(__permits * __one_permit) {
+      }
+
+      ~__semaphore_base() {
+        STDEXEC_ASSERT(__waiters_.empty());
+      }
+
+      auto __try_acquire() noexcept -> bool {
+        std::size_t __state = __state_.load(std::memory_order_relaxed);
+        while (__state >= __one_permit && (__state & __waiters_bit) == 0) {
+          if (__state_.compare_exchange_weak(
+                __state, __state - __one_permit, std::memory_order_acquire,
+                std::memory_order_relaxed)) {
+            return true;
+          }
+        }
+        return false;
+      }
+
+      void __release(std::size_t __count) noexcept {
+        std::size_t __state = __state_.load(std::memory_order_relaxed);
+        while ((__state & __waiters_bit) == 0) {
+          if (__state_.compare_exchange_weak(
+                __state, __state + __count * __one_permit, std::memory_order_release,
+                std::memory_order_relaxed)) {
+            return;
+          }
+        }
+
+        __async_wait::__wake_list __woken;
+        {
+          std::lock_guard __lock{__mutex_};
+          for (; __count != 0 && !__waiters_.empty(); --__count) {
+            __woken.push_back(__waiters_.pop_front());
+          }
+          if (__waiters_.empty()) {
+            // No permits were available while the bit was set.
+            __state_.store(__count * __one_permit, std::memory_order_release);
+          }
+        }
+        __async_wait::__wake_all(__woken);
+      }
+
+      auto __try_fast(__waiter*) noexcept -> bool {
+        return __try_acquire();
+      }
+
+      auto __wait_or_enqueue(__waiter* __wtr) noexcept -> __wait_result {
+        std::lock_guard __lock{__mutex_};
+        if (__wtr->__stop_requested_) {
+          return __wait_result::__stopped;
+        }
+        std::size_t __state = __state_.load(std::memory_order_relaxed);
+        while ((__state & __waiters_bit) == 0) {
+          if (__state >= __one_permit) {
+            if (__state_.compare_exchange_weak(
+                  __state, __state - __one_permit, std::memory_order_acquire,
+                  std::memory_order_relaxed)) {
+              return __wait_result::__ready;
+            }
+          } else if (__state_.compare_exchange_weak(
+                       __state, __state | __waiters_bit, std::memory_order_relaxed)) {
+            break;
+          }
+        }
+        __waiters_.push_back(__wtr);
+        return __wait_result::__queued;
+      }
+
+      auto __cancel(__waiter* __wtr) noexcept -> bool {
+        std::lock_guard __lock{__mutex_};
+        if (!__waiters_.__try_remove(__wtr)) {
+          return false;
+        }
+        if (__waiters_.empty()) {
+          __state_.store(0, std::memory_order_relaxed);
+        }
+        return true;
+      }
+
+      void __give_back(__waiter*) noexcept {
+        __release(1);
+      }
+
+     private:
+      std::atomic<std::size_t> __state_;
+      std::mutex __mutex_;
+      __async_wait::__waiter_list __waiters_;
+    };
+
+    using __sender = __async_wait::__sender<__semaphore_base>;
+  } // namespace __sem
+
+  //! A counting semaphore for asynchronous code. `acquire()` returns a sender that completes
+  //! with `set_value()` once a permit has been acquired, and with `set_stopped()` if stop is
+  //! requested on the receiver's stop token while it is waiting. Permits are given out in
+  //! the order in which they were asked for. A waiter that gets a permit from another thread
+  //! resumes on the scheduler of its receiver's environment, if it has one, and returns the
+  //! permit if that scheduler fails to run it, completing with the scheduler's error or stopped.
+  //!
+  //! Waiting operations are queued in their operation states, so waiting does not allocate.
+  //! Acquiring and releasing a permit take no lock unless an operation is waiting.
+  class async_semaphore : __sem::__semaphore_base {
+   public:
+    explicit async_semaphore(std::size_t __permits) noexcept
+      : __sem::__semaphore_base(__permits) {
+    }
+
+    async_semaphore(async_semaphore&&) = delete;
+
+    [[nodiscard]]
+    auto acquire() noexcept -> __sem::__sender {
+      return __sem::__sender{this};
+    }
+
+    [[nodiscard]]
+    auto try_acquire() noexcept -> bool {
+      return this->__try_acquire();
+    }
+
+    void release(std::size_t __count = 1) noexcept {
+      this->__release(__count);
+    }
+  };
+} // namespace exec
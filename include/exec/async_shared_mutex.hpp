@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../stdexec/execution.hpp"
+
+#include "./__detail/__async_wait.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+
+namespace exec {
+  namespace __shared_mtx {
+    using namespace stdexec;
+    using __async_wait::__wait_result;
+    using __async_wait::__waiter;
+
+    enum __kind : int {
+      __exclusive = 0,
+      __shared = 1
+    };
+
+    // `__state_` holds the number of readers shifted left by two, a bit that is set while a
+    // writer owns the mutex and a bit that is set while the queue of waiters is non-empty. As
+    // in async_semaphore, the uncontended paths are a single CAS, and while the waiters bit is
+    // set, `__state_` only changes under `__mutex_`. Ownership is handed to waiters in FIFO
+    // order: a reader that arrives after a queued writer waits behind it, and when the writer
+    // at the front of the queue gets the mutex, the readers that follow it get it together
+    // once it is released.
+    class __shared_mutex_base {
+      static constexpr std::size_t __waiters_bit = 1;
+      static constexpr std::size_t __writer_bit = 2;
+      static constexpr std::size_t __one_reader = 4;
+
+     public:
+      static constexpr bool __stoppable = true;
+
+      __shared_mutex_base() noexcept = default;
+
+      ~__shared_mutex_base() {
+        STDEXEC_ASSERT(__waiters_.empty());
+        STDEXEC_ASSERT(__state_.load(std::memory_order_relaxed) == 0);
+      }
+
+      auto __try_lock() noexcept -> bool {
+        std::size_t __state = 0;
+        return __state_.compare_exchange_strong(
+          __state, __writer_bit, std::memory_order_acquire, std::memory_order_relaxed);
+      }
+
+      auto __try_lock_shared() noexcept -> bool {
+        std::size_t __state = __state_.load(std::memory_order_relaxed);
+        while ((__state & (__waiters_bit | __writer_bit)) == 0) {
+          if (__state_.compare_exchange_weak(
+                __state, __state + __one_reader, std::memory_order_acquire,
+                std::memory_order_relaxed)) {
+            return true;
+          }
+        }
+        return false;
+      }
+
+      void __unlock() noexcept {
+        __release(__writer_bit);
+      }
+
+      void __unlock_shared() noexcept {
+        __release(__one_reader);
+      }
+
+      auto __try_fast(__waiter* __wtr) noexcept -> bool {
+        return __wtr->__kind_ == __shared ? __try_lock_shared() : __try_lock();
+      }
+
+      auto __wait_or_enqueue(__waiter* __wtr) noexcept -> __wait_result {
+        std::lock_guard __lock{__mutex_};
+        if (__wtr->__stop_requested_) {
+          return __wait_result::__stopped;
+        }
+        std::size_t __state = __state_.load(std::memory_order_relaxed);
+        while ((__state & __waiters_bit) == 0) {
+          if (__can_acquire(__state, __wtr->__kind_)) {
+            if (__state_.compare_exchange_weak(
+                  __state, __acquire(__state, __wtr->__kind_), std::memory_order_acquire,
+                  std::memory_order_relaxed)) {
+              return __wait_result::__ready;
+            }
+          } else if (__state_.compare_exchange_weak(
+                       __state, __state | __waiters_bit, std::memory_order_relaxed)) {
+            break;
+          }
+        }
+        __waiters_.push_back(__wtr);
+        return __wait_result::__queued;
+      }
+
+      auto __cancel(__waiter* __wtr) noexcept -> bool {
+        __async_wait::__wake_list __woken;
+        {
+          std::lock_guard __lock{__mutex_};
+          if (!__waiters_.__try_remove(__wtr)) {
+            return false;
+          }
+          // The waiter may have been a writer that held up the readers behind it.
+          __grant_locked(__state_.load(std::memory_order_relaxed), __woken);
+        }
+        __async_wait::__wake_all(__woken);
+        return true;
+      }
+
+      void __give_back(__waiter* __wtr) noexcept {
+        __release(__wtr->__kind_ == __shared ? __one_reader : __writer_bit);
+      }
+
+     private:
+      static auto __can_acquire(std::size_t __state, int __kind) noexcept -> bool {
+        return __kind == __shared ? (__state & __writer_bit) == 0
+                                  : (__state & ~__waiters_bit) == 0;
+      }
+
+      static auto __acquire(std::size_t __state, int __kind) noexcept -> std::size_t {
+        return __state + (__kind == __shared ? __one_reader : __writer_bit);
+      }
+
+      // Gives up one unit of ownership: a reader or the writer.
+      void __release(std::size_t __unit) noexcept {
+        std::size_t __state = __state_.load(std::memory_order_relaxed);
+        while ((__state & __waiters_bit) == 0) {
+          if (__state_.compare_exchange_weak(
+                __state, __state - __unit, std::memory_order_release,
+                std::memory_order_relaxed)) {
+            return;
+          }
+        }
+
+        __async_wait::__wake_list __woken;
+        {
+          std::lock_guard __lock{__mutex_};
+          __grant_locked(__state_.load(std::memory_order_relaxed) - __unit, __woken);
+        }
+        __async_wait::__wake_all(__woken);
+      }
+
+      // Hands ownership to the waiters at the front of the queue that can have it and publishes
+      // the new state. Must be called with the lock held and the waiters bit set.
+      void __grant_locked(std::size_t __state, __async_wait::__wake_list& __woken) noexcept {
+        while (!__waiters_.empty() && __can_acquire(__state, __waiters_.front()->__kind_)) {
+          __state = __acquire(__state, __waiters_.front()->__kind_);
+          __woken.push_back(__waiters_.pop_front());
+        }
+        if (__waiters_.empty()) {
+          __state &= ~__waiters_bit;
+        }
+        __state_.store(__state, std::memory_order_release);
+      }
+
+      std::atomic<std::size_t> __state_{0};
+      std::mutex __mutex_;
+      __async_wait::__waiter_list __waiters_;
+    };
+
+    using __sender = __async_wait::__sender<__shared_mutex_base>;
+  } // namespace __shared_mtx
+
+  //! A reader-writer mutex for asynchronous code. `lock()` and `lock_shared()` return senders
+  //! that complete with `set_value()` once exclusive or shared ownership has been acquired, and
+  //! with `set_stopped()` if stop is requested on the receiver's stop token while they wait.
+  //!
+  //! Ownership is handed out in FIFO order, so a steady stream of readers cannot starve a
+  //! writer. A waiter that is handed ownership by another thread resumes on the scheduler of its
+  //! receiver's environment, if it has one, rather than on the releasing thread; it gives the
+  //! ownership back if that scheduler completes with an error or stopped instead. Waiting
+  //! operations are queued in their operation states, and the uncontended paths take no lock.
+  class async_shared_mutex : __shared_mtx::__shared_mutex_base {
+   public:
+    async_shared_mutex() noexcept = default;
+
+    async_shared_mutex(async_shared_mutex&&) = delete;
+
+    [[nodiscard]]
+    auto lock() noexcept -> __shared_mtx::__sender {
+      return __shared_mtx::__sender{this, __shared_mtx::__exclusive};
+    }
+
+    [[nodiscard]]
+    auto try_lock() noexcept -> bool {
+      return this->__try_lock();
+    }
+
+    void unlock() noexcept {
+      this->__unlock();
+    }
+
+    [[nodiscard]]
+    auto lock_shared() noexcept -> __shared_mtx::__sender {
+      return __shared_mtx::__sender{this, __shared_mtx::__shared};
+    }
+
+    [[nodiscard]]
+    auto try_lock_shared() noexcept -> bool {
+      return this->__try_lock_shared();
+    }
+
+    void unlock_shared() noexcept {
+      this->__unlock_shared();
+    }
+  };
+} // namespace exec
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../stdexec/execution.hpp"
+#include "../stdexec/__detail/__meta.hpp"
+#include "../stdexec/__detail/__basic_sender.hpp"
+
+#include <concepts>
+#include <exception>
+
+namespace exec {
+  /////////////////////////////////////////////////////////////////////////////
+  // bulk_chunked(Sender, Shape, Function)
+  //
+  // Like `stdexec::bulk`, but `Function` is invoked as `fun(begin, end, args...)` for
+  // sub-ranges `[begin, end)` that partition `[0, shape)`. The function can then run a tight
+  // loop over its range, which the compiler can vectorize. How the range is split is up to the
+  // scheduler: the default implementation calls the function once for the whole range.
+  namespace __bulk_chunked {
+    using namespace stdexec;
+
+    inline constexpr __mstring __bulk_chunked_context =
+      "In exec::bulk_chunked(Sender, Shape, Function)..."_mstr;
+    using __on_not_callable = __callable_error<__bulk_chunked_context>;
+
+    template <class _Shape, class _Fun>
+    struct __data {
+      _Shape __shape_;
+      STDEXEC_ATTRIBUTE((no_unique_address)) _Fun __fun_;
+      static constexpr auto __mbrs_ = __mliterals<&__data::__shape_, &__data::__fun_>();
+    };
+    template <class _Shape, class _Fun>
+    __data(_Shape, _Fun) -> __data<_Shape, _Fun>;
+
+    template <class _Ty>
+    using __decay_ref = __decay_t<_Ty>&;
+
+    template <class _Fun, class _Shape, class... _Args>
+    using __nothrow_chunk_invocable_t = __nothrow_invocable_t<_Fun, _Shape, _Shape, _Args...>;
+
+    template <class _Catch, class _Fun, class _Shape, class _CvrefSender, class... _Env>
+    using __with_error_invoke_t = //
+      __if<
+        __value_types_t<
+          __completion_signatures_of_t<_CvrefSender, _Env...>,
+          __mtransform<
+            __q<__decay_ref>,
+            __mbind_front<__mtry_catch_q<__nothrow_chunk_invocable_t, _Catch>, _Fun, _Shape>>,
+          __q<__mand>>,
+        completion_signatures<>,
+        __eptr_completion>;
+
+    template <class _Fun, class _Shape, class _CvrefSender, class... _Env>
+    using __completion_signatures = //
+      transform_completion_signatures<
+        __completion_signatures_of_t<_CvrefSender, _Env...>,
+        __with_error_invoke_t<__on_not_callable, _Fun, _Shape, _CvrefSender, _Env...>>;
+
+    //! Adapts a chunked function to the element-wise interface of `stdexec::bulk`, so that
+    //! schedulers can reuse their `bulk` implementation. Schedulers that know about it call
+    //! `__invoke_chunk` for the range of indices assigned to an agent.
+    template <class _Fun>
+    struct __bulk_fn {
+      STDEXEC_ATTRIBUTE((no_unique_address)) _Fun __fun_;
+
+      template <std::integral _Shape, class... _Args>
+        requires __callable<_Fun&, _Shape, _Shape, _Args&...>
+      void operator()(_Shape __i, _Args&... __args) //
+        noexcept(__nothrow_callable<_Fun&, _Shape, _Shape, _Args&...>) {
+        __fun_(__i, static_cast<_Shape>(__i + 1), __args...);
+      }
+    };
+
+    template <class _Fun>
+    inline constexpr bool __is_bulk_fn = false;
+
+    template <class _Fun>
+    inline constexpr bool __is_bulk_fn<__bulk_fn<_Fun>> = true;
+
+    //! Runs the indices `[__begin, __end)` of a bulk function: with a single call if the
+    //! function came from `bulk_chunked`, and one call per index otherwise.
+    template <class _Fun, class _Shape, class... _Args>
+    STDEXEC_ATTRIBUTE((always_inline)) void
+      __invoke_chunk(_Fun& __fun, _Shape __begin, _Shape __end, _Args&... __args) //
+      noexcept(noexcept(__fun(__begin, __args...))) {
+      if constexpr (__is_bulk_fn<_Fun>) {
+        if (__begin != __end) {
+          __fun.__fun_(__begin, __end, __args...);
+        }
+      } else {
+        for (_Shape __i = __begin; __i < __end; ++__i) {
+          __fun(__i, __args...);
+        }
+      }
+    }
+
+    struct bulk_chunked_t {
+      template <sender _Sender, std::integral _Shape, __movable_value _Fun>
+      auto operator()(_Sender&& __sndr, _Shape __shape, _Fun __fun) const
+        -> __well_formed_sender auto {
+        auto __domain = __get_early_domain(__sndr);
+        return stdexec::transform_sender(
+          __domain,
+          __make_sexpr<bulk_chunked_t>(
+            __data{__shape, static_cast<_Fun&&>(__fun)}, static_cast<_Sender&&>(__sndr)));
+      }
+
+      template <std::integral _Shape, class _Fun>
+      STDEXEC_ATTRIBUTE((always_inline)) auto operator()(_Shape __shape, _Fun __fun) const
+        -> __binder_back<bulk_chunked_t, _Shape, _Fun> {
+        return {
+          {static_cast<_Shape&&>(__shape), static_cast<_Fun&&>(__fun)},
+          {},
+          {}
+        };
+      }
+    };
+
+    struct __bulk_chunked_impl : __sexpr_defaults {
+      template <class _Sender>
+      using __fun_t = decltype(__decay_t<__data_of<_Sender>>::__fun_);
+
+      template <class _Sender>
+      using __shape_t = decltype(__decay_t<__data_of<_Sender>>::__shape_);
+
+      static constexpr auto get_completion_signatures = //
+        []<class _Sender, class... _Env>(_Sender&&, _Env&&...) noexcept
+        -> __completion_signatures<
+          __fun_t<_Sender>,
+          __shape_t<_Sender>,
+          __child_of<_Sender>,
+          _Env...> {
+        static_assert(sender_expr_for<_Sender, bulk_chunked_t>);
+        return {};
+      };
+
+      //! The default implementation invokes the function once for the whole range, on the
+      //! thread that completes the input sender. Parallel schedulers customize this.
+      static constexpr auto complete = //
+        []<class _Tag, class _State, class _Receiver, class... _Args>(
+          __ignore,
+          _State& __state,
+          _Receiver& __rcvr,
+          _Tag,
+          _Args&&... __args) noexcept -> void {
+        if constexpr (same_as<_Tag, set_value_t>) {
+          using __shape_t = decltype(__state.__shape_);
+          if constexpr (noexcept(__state.__fun_(__shape_t{}, __shape_t{}, __args...))) {
+            if (__state.__shape_ != __shape_t{}) {
+              __state.__fun_(__shape_t{}, __state.__shape_, __args...);
+            }
+            _Tag()(static_cast<_Receiver&&>(__rcvr), static_cast<_Args&&>(__args)...);
+          } else {
+            try {
+              if (__state.__shape_ != __shape_t{}) {
+                __state.__fun_(__shape_t{}, __state.__shape_, __args...);
+              }
+              _Tag()(static_cast<_Receiver&&>(__rcvr), static_cast<_Args&&>(__args)...);
+            } catch (...) {
+              stdexec::set_error(static_cast<_Receiver&&>(__rcvr), std::current_exception());
+            }
+          }
+        } else {
+          _Tag()(static_cast<_Receiver&&>(__rcvr), static_cast<_Args&&>(__args)...);
+        }
+      };
+    };
+  } // namespace __bulk_chunked
+
+  using __bulk_chunked::bulk_chunked_t;
+  inline constexpr bulk_chunked_t bulk_chunked{};
+} // namespace exec
+
+namespace stdexec {
+  template <>
+  struct __sexpr_impl<exec::bulk_chunked_t> : exec::__bulk_chunked::__bulk_chunked_impl { };
+} // namespace stdexec
@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../stdexec/execution.hpp"
+#include "../stdexec/__detail/__meta.hpp"
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <utility>
+
+namespace exec {
+  //! The order in which the tiles of an N-dimensional `bulk_nd` are enumerated.
+  //! `bulk_nd` hands out tiles as a contiguous range per execution agent, so the order
+  //! decides how compact the set of tiles processed by one agent is.
+  enum class tile_order {
+    //! Tiles are enumerated in row-major order (the last dimension varies fastest).
+    row_major,
+    //! Tiles are enumerated along a Morton (Z-order) curve, clipped to the extents.
+    //! Contiguous ranges of tiles form compact blocks.
+    morton
+  };
+
+  namespace __bulk_nd {
+    using namespace stdexec;
+
+    template <std::size_t, class _Ty>
+    using __repeat_t = _Ty;
+
+    template <class _Fun, class _Index, class _Indices, class... _Args>
+    inline constexpr bool __callable_at = false;
+
+    template <class _Fun, class _Index, std::size_t... _Is, class... _Args>
+    inline constexpr bool __callable_at<_Fun, _Index, std::index_sequence<_Is...>, _Args...> =
+      __callable<_Fun&, __repeat_t<_Is, _Index>..., _Args&...>;
+
+    template <class _Fun, class _Index, class _Indices, class... _Args>
+    inline constexpr bool __nothrow_callable_at = false;
+
+    template <class _Fun, class _Index, std::size_t... _Is, class... _Args>
+    inline constexpr bool
+      __nothrow_callable_at<_Fun, _Index, std::index_sequence<_Is...>, _Args...> =
+        __nothrow_callable<_Fun&, __repeat_t<_Is, _Index>..., _Args&...>;
+
+    //! Maps the index of a tile to its coordinates in the grid of tiles.
+    template <class _Index, std::size_t _Rank>
+    struct __tiling {
+      using __coords_t = std::array<_Index, _Rank>;
+
+      __coords_t __extents_;
+      __coords_t __tile_;
+      __coords_t __num_tiles_;
+      tile_order __order_;
+      int __levels_;
+
+      __tiling(__coords_t __extents, __coords_t __tile, tile_order __order) noexcept
+        : __extents_(__extents)
+        , __tile_(__tile)
+        , __num_tiles_{}
+        , __order_(__order)
+        , __levels_(0) {
+        for (std::size_t __d = 0; __d < _Rank; ++__d) {
+          STDEXEC_ASSERT(__extents_[__d] >= 0);
+          STDEXEC_ASSERT(__tile_[__d] > 0);
+          __num_tiles_[__d] = (__extents_[__d] + __tile_[__d] - 1) / __tile_[__d];
+          while ((_Index{1} << __levels_) < __num_tiles_[__d]) {
+            ++__levels_;
+          }
+        }
+      }
+
+      [[nodiscard]]
+      auto __size() const noexcept -> _Index {
+        _Index __n = 1;
+        for (std::size_t __d = 0; __d < _Rank; ++__d) {
+          __n *= __num_tiles_[__d];
+        }
+        return __n;
+      }
+
+      [[nodiscard]]
+      auto __coords(_Index __t) const noexcept -> __coords_t {
+        if (__order_ == tile_order::row_major) {
+          return __row_major_coords(__t);
+        } else {
+          return __morton_coords(__t);
+        }
+      }
+
+      [[nodiscard]]
+      auto __row_major_coords(_Index __t) const noexcept -> __coords_t {
+        __coords_t __coords{};
+        for (std::size_t __d = _Rank; __d-- > 0;) {
+          __coords[__d] = __t % __num_tiles_[__d];
+          __t /= __num_tiles_[__d];
+        }
+        return __coords;
+      }
+
+      //! The grid of tiles is padded to a power of two in every dimension and recursively split
+      //! into 2^Rank children. Only the tiles inside the grid are counted, so the `__t`-th tile is
+      //! found by descending into the child that contains it. This is O(levels * 2^Rank) per tile.
+      [[nodiscard]]
+      auto __morton_coords(_Index __t) const noexcept -> __coords_t {
+        __coords_t __lo{};
+        for (int __level = __levels_; __level-- > 0;) {
+          const _Index __half = _Index{1} << __level;
+          for (std::size_t __child = 0; __child < (std::size_t{1} << _Rank); ++__child) {
+            __coords_t __child_lo = __lo;
+            _Index __count = 1;
+            for (std::size_t __d = 0; __d < _Rank; ++__d) {
+              // The last dimension varies fastest, as in row-major order.
+              if ((__child >> (_Rank - 1 - __d)) & 1) {
+                __child_lo[__d] += __half;
+              }
+              const _Index __end = __child_lo[__d] + __half;
+              __count *= __child_lo[__d] >= __num_tiles_[__d]
+                         ? _Index{0}
+                         : (__end < __num_tiles_[__d] ? __end : __num_tiles_[__d]) - __child_lo[__d];
+            }
+            if (__t < __count) {
+              __lo = __child_lo;
+              break;
+            }
+            __t -= __count;
+          }
+        }
+        return __lo;
+      }
+    };
+
+    //! The function passed to the one-dimensional `bulk`: index `__t` runs the user's
+    //! function over all the elements of the `__t`-th tile, in row-major order.
+    template <class _Index, std::size_t _Rank, class _Fun>
+    struct __tile_fn {
+      using __indices_t = std::make_index_sequence<_Rank>;
+
+      __tiling<_Index, _Rank> __tiling_;
+      STDEXEC_ATTRIBUTE((no_unique_address)) _Fun __fun_;
+
+      template <class... _Args>
+        requires __callable_at<_Fun, _Index, __indices_t, _Args...>
+      void operator()(_Index __t, _Args&... __args) //
+        noexcept(__nothrow_callable_at<_Fun, _Index, __indices_t, _Args...>) {
+        std::array<_Index, _Rank> __lo = __tiling_.__coords(__t);
+        std::array<_Index, _Rank> __hi{};
+        for (std::size_t __d = 0; __d < _Rank; ++__d) {
+          __lo[__d] *= __tiling_.__tile_[__d];
+          const _Index __end = __lo[__d] + __tiling_.__tile_[__d];
+          __hi[__d] = __end < __tiling_.__extents_[__d] ? __end : __tiling_.__extents_[__d];
+        }
+        std::array<_Index, _Rank> __idx{};
+        __loop<0>(__lo, __hi, __idx, __args...);
+      }
+
+     private:
+      template <std::size_t _Dim, class... _Args>
+      void __loop(
+        const std::array<_Index, _Rank>& __lo,
+        const std::array<_Index, _Rank>& __hi,
+        std::array<_Index, _Rank>& __idx,
+        _Args&... __args) {
+        for (__idx[_Dim] = __lo[_Dim]; __idx[_Dim] < __hi[_Dim]; ++__idx[_Dim]) {
+          if constexpr (_Dim + 1 == _Rank) {
+            [&]<std::size_t... _Is>(std::index_sequence<_Is...>) {
+              __fun_(__idx[_Is]..., __args...);
+            }(__indices_t());
+          } else {
+            __loop<_Dim + 1>(__lo, __hi, __idx, __args...);
+          }
+        }
+      }
+    };
+
+    struct bulk_nd_t {
+      //! Invokes `__fun(i0, ..., iN-1, args...)` for every index of the N-dimensional
+      //! `__extents`. The index space is split into tiles of size `__tile`, and the tiles are the
+      //! unit of parallelism: this lowers to `stdexec::bulk` over the number of tiles, so
+      //! schedulers that customize `bulk` distribute contiguous ranges of tiles to their agents.
+      template <sender _Sender, std::integral _Index, std::size_t _Rank, __movable_value _Fun>
+        requires(_Rank > 0)
+      auto operator()(
+        _Sender&& __sndr,
+        std::array<_Index, _Rank> __extents,
+        std::array<_Index, _Rank> __tile,
+        _Fun __fun,
+        tile_order __order = tile_order::morton) const {
+        __tiling<_Index, _Rank> __tiling{__extents, __tile, __order};
+        const _Index __num_tiles = __tiling.__size();
+        return stdexec::bulk(
+          static_cast<_Sender&&>(__sndr),
+          __num_tiles,
+          __tile_fn<_Index, _Rank, _Fun>{__tiling, static_cast<_Fun&&>(__fun)});
+      }
+
+      template <std::integral _Index, std::size_t _Rank, class _Fun>
+      STDEXEC_ATTRIBUTE((always_inline)) auto operator()(
+        std::array<_Index, _Rank> __extents,
+        std::array<_Index, _Rank> __tile,
+        _Fun __fun,
+        tile_order __order = tile_order::morton) const
+        -> __binder_back<
+          bulk_nd_t,
+          std::array<_Index, _Rank>,
+          std::array<_Index, _Rank>,
+          _Fun,
+          tile_order> {
+        return {
+          {__extents, __tile, static_cast<_Fun&&>(__fun), __order},
+          {},
+          {}
+        };
+      }
+    };
+  } // namespace __bulk_nd
+
+  using __bulk_nd::bulk_nd_t;
+  inline constexpr bulk_nd_t bulk_nd{};
+} // namespace exec
@@ -0,0 +1,466 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../stdexec/execution.hpp"
+#include "../stdexec/__detail/__optional.hpp"
+
+#include "timed_scheduler.hpp"
+#include "when_any.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+
+namespace exec {
+  namespace __deadline {
+    using namespace stdexec;
+    using __clock = std::chrono::steady_clock;
+
+    //! Asks the environment of a receiver for the point in time by which the operation it is
+    //! connected to should be complete. Deadlines are measured on `std::chrono::steady_clock`.
+    struct get_deadline_t : __query<get_deadline_t> {
+      static constexpr auto query(forwarding_query_t) noexcept -> bool {
+        return true;
+      }
+
+      template <class _Env>
+        requires tag_invocable<get_deadline_t, const _Env&>
+      auto operator()(const _Env& __env) const noexcept -> __clock::time_point {
+        static_assert(nothrow_tag_invocable<get_deadline_t, const _Env&>);
+        return tag_invoke(get_deadline_t{}, __env);
+      }
+    };
+  } // namespace __deadline
+
+  using __deadline::get_deadline_t;
+  inline constexpr get_deadline_t get_deadline{};
+
+  namespace __deadline {
+    // The deadline of an operation is fixed when it starts: either a given point in time or a
+    // given duration from then. It never extends the deadline of the enclosing operation.
+    struct __at {
+      __clock::time_point __time_point_;
+
+      [[nodiscard]]
+      auto __resolve() const noexcept -> __clock::time_point {
+        return __time_point_;
+      }
+    };
+
+    struct __after {
+      __clock::duration __duration_;
+
+      [[nodiscard]]
+      auto __resolve() const noexcept -> __clock::time_point {
+        return __clock::now() + __duration_;
+      }
+    };
+
+    template <class _When, class _Env>
+    auto __tighter_deadline(const _When& __when, const _Env& __env) noexcept
+      -> __clock::time_point {
+      if constexpr (__callable<get_deadline_t, const _Env&>) {
+        return (std::min) (__when.__resolve(), get_deadline(__env));
+      } else {
+        return __when.__resolve();
+      }
+    }
+
+    // Only propagate the deadline to the child; it is up to the child to honor it.
+    struct __no_timer { };
+
+    template <class _Env>
+    using __env_t = __env::__join_t<prop<get_deadline_t, __clock::time_point>, _Env>;
+
+    template <class _Env>
+    using __timed_env_t = __env::__join_t<
+      env<prop<get_deadline_t, __clock::time_point>, prop<get_stop_token_t, inplace_stop_token>>,
+      _Env>;
+
+    template <class _ReceiverId, class _When>
+    struct __operation_base : __immovable {
+      using _Receiver = stdexec::__t<_ReceiverId>;
+
+      STDEXEC_ATTRIBUTE((no_unique_address)) _Receiver __rcvr_;
+      _When __when_;
+      __clock::time_point __deadline_{};
+    };
+
+    template <class _ReceiverId, class _When>
+    struct __receiver {
+      using _Receiver = stdexec::__t<_ReceiverId>;
+
+      struct __t {
+        using __id = __receiver;
+        using receiver_concept = receiver_t;
+        __operation_base<_ReceiverId, _When>* __op_;
+
+        template <class... _As>
+        void set_value(_As&&... __as) noexcept {
+          stdexec::set_value(static_cast<_Receiver&&>(__op_->__rcvr_), static_cast<_As&&>(__as)...);
+        }
+
+        template <class _Error>
+        void set_error(_Error&& __err) noexcept {
+          stdexec::set_error(
+            static_cast<_Receiver&&>(__op_->__rcvr_), static_cast<_Error&&>(__err));
+        }
+
+        void set_stopped() noexcept {
+          stdexec::set_stopped(static_cast<_Receiver&&>(__op_->__rcvr_));
+        }
+
+        auto get_env() const noexcept -> __env_t<env_of_t<_Receiver>> {
+          return __env::__join(
+            prop{get_deadline, __op_->__deadline_}, stdexec::get_env(__op_->__rcvr_));
+        }
+      };
+    };
+
+    template <class _CvrefSenderId, class _ReceiverId, class _When>
+    struct __operation {
+      using _CvrefSender = stdexec::__cvref_t<_CvrefSenderId>;
+      using _Receiver = stdexec::__t<_ReceiverId>;
+      using __receiver_t = stdexec::__t<__receiver<_ReceiverId, _When>>;
+
+      struct __t : __operation_base<_ReceiverId, _When> {
+        using __id = __operation;
+
+        __t(_CvrefSender&& __sndr, _Receiver __rcvr, _When __when)
+          : __operation_base<_ReceiverId, _When>{{}, static_cast<_Receiver&&>(__rcvr), __when}
+          , __child_op_(stdexec::connect(static_cast<_CvrefSender&&>(__sndr), __receiver_t{this})) {
+        }
+
+        void start() & noexcept {
+          this->__deadline_ =
+            __deadline::__tighter_deadline(this->__when_, stdexec::get_env(this->__rcvr_));
+          stdexec::start(__child_op_);
+        }
+
+       private:
+        connect_result_t<_CvrefSender, __receiver_t> __child_op_;
+      };
+    };
+
+    // The child and a timer that fires at the deadline run side by side. When the timer fires,
+    // stop is requested on the child. When the child completes, stop is requested on the timer.
+    // The result of the child is forwarded once both have completed.
+    template <class _ReceiverId, class _When, class _ResultVariant>
+    struct __timed_operation_base : __operation_base<_ReceiverId, _When> {
+      using _Receiver = stdexec::__t<_ReceiverId>;
+
+      struct __on_stop_requested {
+        __timed_operation_base* __self_;
+
+        void operator()() const noexcept {
+          __self_->__stop_source_.request_stop();
+          __self_->__timer_stop_source_.request_stop();
+        }
+      };
+
+      using __on_stop_t =
+        stop_callback_for_t<stop_token_of_t<env_of_t<_Receiver>>, __on_stop_requested>;
+
+      template <class _Tag, class... _Args>
+      void __notify(_Tag, _Args&&... __args) noexcept {
+        using __result_t = __decayed_tuple<_Tag, _Args...>;
+        if constexpr ((__nothrow_decay_copyable<_Args> && ...)) {
+          __result_.template emplace<__result_t>(_Tag{}, static_cast<_Args&&>(__args)...);
+        } else {
+          try {
+            __result_.template emplace<__result_t>(_Tag{}, static_cast<_Args&&>(__args)...);
+          } catch (...) {
+            using __error_t = __tuple_for<set_error_t, std::exception_ptr>;
+            __result_.template emplace<__error_t>(set_error_t{}, std::current_exception());
+          }
+        }
+        __timer_stop_source_.request_stop();
+        __arrive();
+      }
+
+      void __arrive() noexcept {
+        if (__count_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+          __on_stop_.reset();
+          STDEXEC_ASSERT(!__result_.is_valueless());
+          __result_.visit(
+            __when_any::__make_visitor_fn(this->__rcvr_), static_cast<_ResultVariant&&>(__result_));
+        }
+      }
+
+      inplace_stop_source __stop_source_{};
+      inplace_stop_source __timer_stop_source_{};
+      stdexec::__optional<__on_stop_t> __on_stop_{};
+      std::atomic<int> __count_{2};
+      _ResultVariant __result_{};
+    };
+
+    template <class _ReceiverId, class _When, class _ResultVariant>
+    struct __timed_receiver {
+      using _Receiver = stdexec::__t<_ReceiverId>;
+
+      struct __t {
+        using __id = __timed_receiver;
+        using receiver_concept = receiver_t;
+        __timed_operation_base<_ReceiverId, _When, _ResultVariant>* __op_;
+
+        template <class... _As>
+        void set_value(_As&&... __as) noexcept {
+          __op_->__notify(set_value_t{}, static_cast<_As&&>(__as)...);
+        }
+
+        template <class _Error>
+        void set_error(_Error&& __err) noexcept {
+          __op_->__notify(set_error_t{}, static_cast<_Error&&>(__err));
+        }
+
+        void set_stopped() noexcept {
+          __op_->__notify(set_stopped_t{});
+        }
+
+        auto get_env() const noexcept -> __timed_env_t<env_of_t<_Receiver>> {
+          return __env::__join(
+            env{
+              prop{get_deadline, __op_->__deadline_},
+              prop{get_stop_token, __op_->__stop_source_.get_token()}},
+            stdexec::get_env(__op_->__rcvr_));
+        }
+      };
+    };
+
+    template <class _ReceiverId, class _When, class _ResultVariant>
+    struct __timer_receiver {
+      using receiver_concept = receiver_t;
+      __timed_operation_base<_ReceiverId, _When, _ResultVariant>* __op_;
+
+      void set_value() noexcept {
+        __op_->__stop_source_.request_stop();
+        __op_->__arrive();
+      }
+
+      template <class _Error>
+      void set_error(_Error&&) noexcept {
+        __op_->__arrive();
+      }
+
+      void set_stopped() noexcept {
+        __op_->__arrive();
+      }
+
+      auto get_env() const noexcept -> prop<get_stop_token_t, inplace_stop_token> {
+        return prop{get_stop_token, __op_->__timer_stop_source_.get_token()};
+      }
+    };
+
+    template <class _Env, class _CvrefSender>
+    using __timed_completions_t = __mtry_q<__concat_completion_signatures>::__f<
+      __minvoke<__when_any::__completions_fn<__timed_env_t<_Env>>, _CvrefSender>,
+      completion_signatures<set_error_t(std::exception_ptr)>>;
+
+    template <class _CvrefSenderId, class _ReceiverId, class _When, class _Scheduler>
+    struct __timed_operation {
+      using _CvrefSender = stdexec::__cvref_t<_CvrefSenderId>;
+      using _Receiver = stdexec::__t<_ReceiverId>;
+      using __result_t = __for_each_completion_signature<
+        __timed_completions_t<env_of_t<_Receiver>, _CvrefSender>,
+        __decayed_tuple,
+        __uniqued_variant_for>;
+      using __base_t = __timed_operation_base<_ReceiverId, _When, __result_t>;
+      using __receiver_t = stdexec::__t<__timed_receiver<_ReceiverId, _When, __result_t>>;
+      using __timer_receiver_t = __timer_receiver<_ReceiverId, _When, __result_t>;
+      using __timer_sender_t =
+        __call_result_t<schedule_at_t, _Scheduler&, const __clock::time_point&>;
+      using __timer_op_t = connect_result_t<__timer_sender_t, __timer_receiver_t>;
+
+      struct __t : __base_t {
+        using __id = __timed_operation;
+
+        __t(_CvrefSender&& __sndr, _Receiver __rcvr, _When __when, _Scheduler __sched)
+          : __base_t{{{}, static_cast<_Receiver&&>(__rcvr), __when}}
+          , __sched_(static_cast<_Scheduler&&>(__sched))
+          , __child_op_(stdexec::connect(static_cast<_CvrefSender&&>(__sndr), __receiver_t{this})) {
+        }
+
+        void start() & noexcept {
+          auto&& __env = stdexec::get_env(this->__rcvr_);
+          this->__deadline_ = __deadline::__tighter_deadline(this->__when_, __env);
+          // The timer can only be connected now that the deadline is known.
+          try {
+            __timer_op_.emplace(__emplace_from{[this] {
+              return stdexec::connect(
+                schedule_at(__sched_, this->__deadline_), __timer_receiver_t{this});
+            }});
+          } catch (...) {
+            stdexec::set_error(static_cast<_Receiver&&>(this->__rcvr_), std::current_exception());
+            return;
+          }
+          this->__on_stop_.emplace(
+            get_stop_token(__env), typename __base_t::__on_stop_requested{this});
+          stdexec::start(__child_op_);
+          stdexec::start(*__timer_op_);
+        }
+
+       private:
+        STDEXEC_ATTRIBUTE((no_unique_address)) _Scheduler __sched_;
+        connect_result_t<_CvrefSender, __receiver_t> __child_op_;
+        stdexec::__optional<__timer_op_t> __timer_op_;
+      };
+    };
+
+    template <class _SenderId, class _When, class _Scheduler>
+    struct __sender {
+      using _Sender = stdexec::__t<_SenderId>;
+      static constexpr bool __timed = !same_as<_Scheduler, __no_timer>;
+
+      struct __t {
+        using __id = __sender;
+        using sender_concept = sender_t;
+
+        template <class _Self, class _Receiver>
+        using __operation_t = stdexec::__t<__if_c<
+          __timed,
+          __timed_operation<
+            __cvref_id<_Self, _Sender>,
+            stdexec::__id<_Receiver>,
+            _When,
+            _Scheduler>,
+          __operation<__cvref_id<_Self, _Sender>, stdexec::__id<_Receiver>, _When>>>;
+
+        template <class _Self, class _Env>
+        using __completions_t = __if_c<
+          __timed,
+          __timed_completions_t<_Env, __copy_cvref_t<_Self, _Sender>>,
+          __completion_signatures_of_t<__copy_cvref_t<_Self, _Sender>, __env_t<_Env>>>;
+
+        template <__decays_to<__t> _Self, receiver _Receiver>
+        static auto connect(_Self&& __self, _Receiver __rcvr) -> __operation_t<_Self, _Receiver> {
+          if constexpr (__timed) {
+            return {
+              static_cast<_Self&&>(__self).__sndr_,
+              static_cast<_Receiver&&>(__rcvr),
+              __self.__when_,
+              __self.__sched_};
+          } else {
+            return {
+              static_cast<_Self&&>(__self).__sndr_,
+              static_cast<_Receiver&&>(__rcvr),
+              __self.__when_};
+          }
+        }
+
+        template <__decays_to<__t> _Self, class _Env>
+        static auto get_completion_signatures(_Self&&, _Env&&) -> __completions_t<_Self, _Env> {
+          return {};
+        }
+
+        _Sender __sndr_;
+        _When __when_;
+        STDEXEC_ATTRIBUTE((no_unique_address)) _Scheduler __sched_;
+      };
+    };
+
+    template <class _Scheduler>
+    concept __steady_timed_scheduler =
+      timed_scheduler<_Scheduler> && same_as<time_point_of_t<_Scheduler>, __clock::time_point>;
+
+    template <class _When>
+    struct __adaptor {
+      template <class _Sender, class _Scheduler>
+      using __sender_t =
+        stdexec::__t<__sender<stdexec::__id<__decay_t<_Sender>>, _When, _Scheduler>>;
+
+      template <sender _Sender>
+      auto __make(_Sender&& __sndr, _When __when) const -> __sender_t<_Sender, __no_timer> {
+        return {static_cast<_Sender&&>(__sndr), __when, {}};
+      }
+
+      template <sender _Sender, __steady_timed_scheduler _Scheduler>
+      auto __make(_Sender&& __sndr, _Scheduler __sched, _When __when) const
+        -> __sender_t<_Sender, _Scheduler> {
+        return {static_cast<_Sender&&>(__sndr), __when, static_cast<_Scheduler&&>(__sched)};
+      }
+    };
+
+    struct with_deadline_t : __adaptor<__at> {
+      template <sender _Sender>
+      auto operator()(_Sender&& __sndr, __clock::time_point __deadline) const {
+        return this->__make(static_cast<_Sender&&>(__sndr), __at{__deadline});
+      }
+
+      template <sender _Sender, __steady_timed_scheduler _Scheduler>
+      auto
+        operator()(_Sender&& __sndr, _Scheduler __sched, __clock::time_point __deadline) const {
+        return this->__make(
+          static_cast<_Sender&&>(__sndr), static_cast<_Scheduler&&>(__sched), __at{__deadline});
+      }
+
+      STDEXEC_ATTRIBUTE((always_inline)) auto operator()(__clock::time_point __deadline) const
+        -> __binder_back<with_deadline_t, __clock::time_point> {
+        return {{__deadline}, {}, {}};
+      }
+
+      template <__steady_timed_scheduler _Scheduler>
+      STDEXEC_ATTRIBUTE((always_inline)) auto
+        operator()(_Scheduler __sched, __clock::time_point __deadline) const
+        -> __binder_back<with_deadline_t, _Scheduler, __clock::time_point> {
+        return {{static_cast<_Scheduler&&>(__sched), __deadline}, {}, {}};
+      }
+    };
+
+    struct with_timeout_t : __adaptor<__after> {
+      template <sender _Sender>
+      auto operator()(_Sender&& __sndr, __clock::duration __timeout) const {
+        return this->__make(static_cast<_Sender&&>(__sndr), __after{__timeout});
+      }
+
+      template <sender _Sender, __steady_timed_scheduler _Scheduler>
+      auto operator()(_Sender&& __sndr, _Scheduler __sched, __clock::duration __timeout) const {
+        return this->__make(
+          static_cast<_Sender&&>(__sndr), static_cast<_Scheduler&&>(__sched), __after{__timeout});
+      }
+
+      STDEXEC_ATTRIBUTE((always_inline)) auto operator()(__clock::duration __timeout) const
+        -> __binder_back<with_timeout_t, __clock::duration> {
+        return {{__timeout}, {}, {}};
+      }
+
+      template <__steady_timed_scheduler _Scheduler>
+      STDEXEC_ATTRIBUTE((always_inline)) auto
+        operator()(_Scheduler __sched, __clock::duration __timeout) const
+        -> __binder_back<with_timeout_t, _Scheduler, __clock::duration> {
+        return {{static_cast<_Scheduler&&>(__sched), __timeout}, {}, {}};
+      }
+    };
+  } // namespace __deadline
+
+  //! `with_deadline(sndr, tp)` passes the deadline `tp` to `sndr` through the receiver's
+  //! environment, where `get_deadline` finds it. If the environment already has an earlier
+  //! deadline, that one is passed on instead. It is up to `sndr` to honor the deadline; the
+  //! operations of `io_uring_context` do so by arming a linked timeout in the kernel.
+  //!
+  //! `with_deadline(sndr, sched, tp)` also enforces the deadline: it races `sndr` against
+  //! `schedule_at(sched, tp)` on the timed scheduler `sched` and requests stop on `sndr` when
+  //! the deadline passes. It then completes however `sndr` does, typically with
+  //! `set_stopped()`.
+  using __deadline::with_deadline_t;
+  inline constexpr with_deadline_t with_deadline{};
+
+  //! Like `with_deadline`, with the deadline given as a duration from when the operation
+  //! starts.
+  using __deadline::with_timeout_t;
+  inline constexpr with_timeout_t with_timeout{};
+} // namespace exec
@@ -22,6 +22,7 @@
 #  include <linux/io_uring.h>
 
 #  include "../../stdexec/execution.hpp"
+#  include "../deadline.hpp"
 #  include "../timed_scheduler.hpp"
 
 #  include "../__detail/__atomic_intrusive_queue.hpp"
@@ -47,14 +48,33 @@
 
 #    if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 6, 0)
 #      define STDEXEC_HAS_IORING_OP_READ
+#      define STDEXEC_HAS_IORING_OP_SEND
 #    endif
 
+#    if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 8, 0)
+#      define STDEXEC_HAS_IORING_OP_SPLICE
+#    endif
+
+#    if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 11, 0)
+#      define STDEXEC_HAS_IORING_OP_SHUTDOWN
+#    endif
+
+// Zero-copy sends need the headers of Linux 6.0. Running kernels without them are detected at
+// run-time.
+#    if defined(STDEXEC_HAS_IORING_OP_SEND) && defined(IORING_CQE_F_NOTIF)
+#      define STDEXEC_HAS_IORING_OP_SEND_ZC
+#    endif
+
+#    include <fcntl.h>
 #    include <sys/uio.h>
 #    include <sys/eventfd.h>
+#    include <sys/socket.h>
 #    include <sys/syscall.h>
 
 #    include <algorithm>
+#    include <array>
 #    include <cstring>
+#    include <span>
 
 namespace exec {
   namespace __io_uring {
@@ -135,6 +155,12 @@ namespace exec {
 
     struct __task;
 
+    // The layout of the kernel's __kernel_timespec.
+    struct __timespec {
+      __s64 __tv_sec;
+      __s64 __tv_nsec;
+    };
+
     // Each io operation provides the following interface:
     struct __task_vtable {
       // If this function returns true, the __submit_ function will not be called.
@@ -156,6 +182,13 @@ namespace exec {
     struct __task : stdexec::__immovable {
       const __task_vtable* __vtable_;
       __task* __next_{nullptr};
+      // If set, the task is submitted together with a linked IORING_OP_LINK_TIMEOUT that
+      // cancels it at the given time of the monotonic clock. The time is read when the task
+      // is submitted.
+      const __timespec* __link_timeout_{nullptr};
+      // The next task of a linked chain. A chain is pushed to the context through its first task
+      // and its submission queue entries are placed back to back within one submission.
+      __task* __link_next_{nullptr};
 
       explicit __task(const __task_vtable& __vtable)
         : __vtable_{&__vtable} {
@@ -177,10 +210,24 @@ namespace exec {
     };
 
     inline void __stop(__task* __op) noexcept {
-      ::io_uring_cqe __cqe{};
-      __cqe.res = -ECANCELED;
-      __cqe.user_data = bit_cast<__u64>(__op);
-      __op->__vtable_->__complete_(__op, __cqe);
+      while (__op != nullptr) {
+        // Completing the last task of a chain may destroy all of them.
+        __task* __next = __op->__link_next_;
+        ::io_uring_cqe __cqe{};
+        __cqe.res = -ECANCELED;
+        __cqe.user_data = bit_cast<__u64>(__op);
+        __op->__vtable_->__complete_(__op, __cqe);
+        __op = __next;
+      }
+    }
+
+    // The number of submission queue entries that a task and the tasks linked to it take up.
+    inline auto __n_entries(const __task* __op) noexcept -> __u32 {
+      __u32 __n = 0;
+      for (; __op != nullptr; __op = __op->__link_next_) {
+        __n += __op->__link_timeout_ == nullptr ? 1 : 2;
+      }
+      return __n;
     }
 
     // This class implements the io_uring submission queue.
@@ -222,25 +269,51 @@ namespace exec {
         __submission_result __result{};
         __task* __op = nullptr;
         while (!__tasks.empty() && __result.__n_submitted < __max_submissions) {
-          const __u32 __index = __tail & __mask_;
-          ::io_uring_sqe& __sqe = __entries_[__index];
           __op = __tasks.pop_front();
           STDEXEC_ASSERT(__op->__vtable_);
           if (__op->__vtable_->__ready_(__op)) {
             __result.__ready.push_back(__op);
+          } else if (
+            (__op->__link_timeout_ != nullptr || __op->__link_next_ != nullptr)
+            && __result.__n_submitted + __n_entries(__op) > __max_submissions) {
+            // There is no room for the linked entries; submit the task with the next batch.
+            __result.__pending.push_back(__op);
+            break;
           } else {
-            __op->__vtable_->__submit_(__op, __sqe);
+            // The tasks of a chain are submitted one after the other with no gap in between.
+            for (__task* __link = __op; __link != nullptr; __link = __link->__link_next_) {
+              const __u32 __index = __tail & __mask_;
+              ::io_uring_sqe& __sqe = __entries_[__index];
+              __link->__vtable_->__submit_(__link, __sqe);
 #    ifdef STDEXEC_HAS_IO_URING_ASYNC_CANCELLATION
-            if (__is_stopped && __sqe.opcode != IORING_OP_ASYNC_CANCEL) {
+              if (__is_stopped && __sqe.opcode != IORING_OP_ASYNC_CANCEL) {
 #    else
-            if (__is_stopped) {
+              if (__is_stopped) {
 #    endif
-              __stop(__op);
-            } else {
-              __sqe.user_data = bit_cast<__u64>(__op);
+                __stop(__link);
+                break;
+              }
+              __sqe.user_data = bit_cast<__u64>(__link);
               __array_[__index] = __index;
               ++__result.__n_submitted;
               ++__tail;
+#    ifdef STDEXEC_HAS_IO_URING_ASYNC_CANCELLATION
+              if (__link->__link_timeout_ != nullptr) {
+                __sqe.flags |= IOSQE_IO_LINK;
+                const __u32 __timeout_index = __tail & __mask_;
+                ::io_uring_sqe& __timeout_sqe = __entries_[__timeout_index];
+                __timeout_sqe = ::io_uring_sqe{};
+                __timeout_sqe.opcode = IORING_OP_LINK_TIMEOUT;
+                __timeout_sqe.addr = bit_cast<__u64>(__link->__link_timeout_);
+                __timeout_sqe.len = 1;
+                __timeout_sqe.timeout_flags = IORING_TIMEOUT_ABS;
+                // Its completion is not delivered to any task.
+                __timeout_sqe.user_data = 0;
+                __array_[__timeout_index] = __timeout_index;
+                ++__result.__n_submitted;
+                ++__tail;
+              }
+#    endif
             }
           }
         }
@@ -283,10 +356,20 @@ namespace exec {
         while (__head != __tail) {
           const __u32 __index = __head & __mask_;
           const ::io_uring_cqe& __cqe = __entries_[__index];
-          auto* __op = bit_cast<__task*>(__cqe.user_data);
-          __op->__vtable_->__complete_(__op, __cqe);
+          // A user_data of zero marks the completion of a linked timeout.
+          if (__cqe.user_data != 0) {
+            auto* __op = bit_cast<__task*>(__cqe.user_data);
+            __op->__vtable_->__complete_(__op, __cqe);
+          }
           ++__head;
+#    ifdef IORING_CQE_F_MORE
+          // A request that completes more than once is in flight until its last completion.
+          if (!(__cqe.flags & IORING_CQE_F_MORE)) {
+            ++__count;
+          }
+#    else
           ++__count;
+#    endif
           __tail = __tail_.load(std::memory_order_acquire);
         }
         __head_.store(__head, std::memory_order_release);
@@ -864,10 +947,23 @@ namespace exec {
         using __on_receiver_stop_t = std::optional<typename stdexec::stop_token_of_t<
           stdexec::env_of_t<_Receiver>&>::template callback_type<__stop_callback>>;
 
+        // An operation whose receiver has a deadline is cancelled by the kernel when the deadline
+        // passes, without a timer of its own.
+#    ifdef STDEXEC_HAS_IO_URING_ASYNC_CANCELLATION
+        static constexpr bool __has_deadline =
+          stdexec::__callable<get_deadline_t, stdexec::env_of_t<_Receiver>>;
+#    else
+        static constexpr bool __has_deadline = false;
+#    endif
+
+        struct __no_deadline { };
+
         stdexec::__t<__stop_operation<__impl>> __stop_operation_;
         std::atomic<int> __n_ops_{0};
         __on_context_stop_t __on_context_stop_{};
         __on_receiver_stop_t __on_receiver_stop_{};
+        STDEXEC_ATTRIBUTE((no_unique_address))
+        stdexec::__if_c<__has_deadline, __timespec, __no_deadline> __deadline_{};
 
         template <class... _Args>
           requires stdexec::constructible_from<_Base, _Args...>
@@ -875,6 +971,9 @@ namespace exec {
           noexcept(stdexec::__nothrow_constructible_from<_Base, _Args...>)
           : __base_t(__parent, std::in_place, static_cast<_Args&&>(__args)...)
           , __stop_operation_{this} {
+          if constexpr (__has_deadline) {
+            __parent->__link_timeout_ = &__deadline_;
+          }
         }
 
         auto context() noexcept -> __context& {
@@ -903,6 +1002,15 @@ namespace exec {
           __on_context_stop_.emplace(__context_.get_stop_token(), __stop_callback{this});
           __on_receiver_stop_.emplace(
             stdexec::get_stop_token(stdexec::get_env(__receiver)), __stop_callback{this});
+          if constexpr (__has_deadline) {
+            // steady_clock is CLOCK_MONOTONIC, the clock of absolute io_uring timeouts.
+            auto __since_epoch = get_deadline(stdexec::get_env(__receiver)).time_since_epoch();
+            auto __nsec = (std::max) (
+              std::chrono::duration_cast<std::chrono::nanoseconds>(__since_epoch),
+              std::chrono::nanoseconds{0});
+            auto __sec = std::chrono::duration_cast<std::chrono::seconds>(__nsec);
+            __deadline_ = __timespec{__sec.count(), (__nsec - __sec).count()};
+          }
           this->__base_.submit(__sqe);
         }
 
@@ -914,10 +1022,24 @@ namespace exec {
             __context& __context_ = this->__base_.context();
             auto token = stdexec::get_stop_token(stdexec::get_env(__receiver));
             if (__cqe.res == -ECANCELED || __context_.stop_requested() || token.stop_requested()) {
+              __discard(__cqe);
               stdexec::set_stopped(static_cast<_Receiver&&>(__receiver));
             } else {
               this->__base_.complete(__cqe);
             }
+          } else {
+            // The stop operation completes the receiver.
+            __discard(__cqe);
+          }
+        }
+
+        // A request that succeeded although the operation completes with set_stopped() may
+        // have acquired a resource, such as an accepted socket, that nobody else will release.
+        void __discard(const ::io_uring_cqe& __cqe) noexcept {
+          if constexpr (requires { this->__base_.discard(__cqe); }) {
+            if (__cqe.res >= 0) {
+              this->__base_.discard(__cqe);
+            }
           }
         }
       };
@@ -1057,6 +1179,784 @@ namespace exec {
       using __t = __stoppable_task_facade_t<__impl>;
     };
 
+#    ifdef STDEXEC_HAS_IORING_OP_SEND
+    // A single request that completes with no value, or with its result converted to the one
+    // type of `_Values`: a byte count or a new file descriptor.
+    template <class _ReceiverId, class... _Values>
+    struct __io_request_operation {
+      using _Receiver = stdexec::__t<_ReceiverId>;
+
+      class __impl : public __stoppable_op_base<_Receiver> {
+        ::io_uring_sqe __request_;
+
+       public:
+        static constexpr auto ready() noexcept -> std::false_type {
+          return {};
+        }
+
+        void submit(::io_uring_sqe& __sqe) noexcept {
+          __sqe = __request_;
+        }
+
+        void complete(const ::io_uring_cqe& __cqe) noexcept {
+          if (__cqe.res < 0) {
+            stdexec::set_error(
+              static_cast<_Receiver&&>(this->__receiver_),
+              std::make_exception_ptr(std::system_error(-__cqe.res, std::system_category())));
+          } else {
+            stdexec::set_value(
+              static_cast<_Receiver&&>(this->__receiver_), static_cast<_Values>(__cqe.res)...);
+          }
+        }
+
+        // Closes a socket that was accepted after all by a stopped operation.
+        void discard(const ::io_uring_cqe& __cqe) noexcept
+          requires(stdexec::same_as<_Values, int> || ...)
+        {
+          ::close(__cqe.res);
+        }
+
+        __impl(__context& __context, const ::io_uring_sqe& __request, _Receiver&& __receiver)
+          : __stoppable_op_base<_Receiver>{__context, static_cast<_Receiver&&>(__receiver)}
+          , __request_{__request} {
+        }
+      };
+
+      using __t = __stoppable_task_facade_t<__impl>;
+    };
+
+    // Closes a file descriptor. A close cannot be stopped: once it is submitted, the descriptor
+    // may be gone, and reporting set_stopped() would leave the caller unable to tell. It only
+    // completes with set_stopped() if the context stops before the request reaches the kernel.
+    template <class _ReceiverId>
+    struct __close_operation {
+      using _Receiver = stdexec::__t<_ReceiverId>;
+
+      class __impl : public __stoppable_op_base<_Receiver> {
+        int __fd_;
+
+       public:
+        static constexpr auto ready() noexcept -> std::false_type {
+          return {};
+        }
+
+        void submit(::io_uring_sqe& __sqe) noexcept {
+          __sqe = ::io_uring_sqe{};
+          __sqe.opcode = IORING_OP_CLOSE;
+          __sqe.fd = __fd_;
+        }
+
+        void complete(const ::io_uring_cqe& __cqe) noexcept {
+          if (__cqe.res == -ECANCELED) {
+            stdexec::set_stopped(static_cast<_Receiver&&>(this->__receiver_));
+          } else if (__cqe.res < 0) {
+            stdexec::set_error(
+              static_cast<_Receiver&&>(this->__receiver_),
+              std::make_exception_ptr(std::system_error(-__cqe.res, std::system_category())));
+          } else {
+            stdexec::set_value(static_cast<_Receiver&&>(this->__receiver_));
+          }
+        }
+
+        __impl(__context& __context, int __fd, _Receiver&& __receiver)
+          : __stoppable_op_base<_Receiver>{__context, static_cast<_Receiver&&>(__receiver)}
+          , __fd_{__fd} {
+        }
+      };
+
+      using __t = __io_task_facade<__impl>;
+    };
+#    endif
+
+    // A single io_uring request, described by the submission queue entry that the kernel
+    // receives for it. The buffers it refers to have to outlive its submission.
+    struct io_uring_request {
+      ::io_uring_sqe __sqe_{};
+    };
+
+#    ifdef STDEXEC_HAS_IORING_OP_READ
+    // Reads into `__buffer` from `__fd` at `__offset`, or at the file position by default.
+    inline auto io_uring_read(
+      int __fd,
+      std::span<std::byte> __buffer,
+      std::uint64_t __offset = static_cast<std::uint64_t>(-1)) noexcept -> io_uring_request {
+      io_uring_request __request{};
+      __request.__sqe_.opcode = IORING_OP_READ;
+      __request.__sqe_.fd = __fd;
+      __request.__sqe_.addr = bit_cast<__u64>(__buffer.data());
+      __request.__sqe_.len = static_cast<__u32>(__buffer.size());
+      __request.__sqe_.off = __offset;
+      return __request;
+    }
+
+    // Writes `__buffer` to `__fd` at `__offset`, or at the file position by default.
+    inline auto io_uring_write(
+      int __fd,
+      std::span<const std::byte> __buffer,
+      std::uint64_t __offset = static_cast<std::uint64_t>(-1)) noexcept -> io_uring_request {
+      io_uring_request __request{};
+      __request.__sqe_.opcode = IORING_OP_WRITE;
+      __request.__sqe_.fd = __fd;
+      __request.__sqe_.addr = bit_cast<__u64>(__buffer.data());
+      __request.__sqe_.len = static_cast<__u32>(__buffer.size());
+      __request.__sqe_.off = __offset;
+      return __request;
+    }
+#    endif
+
+    inline auto io_uring_fsync(int __fd) noexcept -> io_uring_request {
+      io_uring_request __request{};
+      __request.__sqe_.opcode = IORING_OP_FSYNC;
+      __request.__sqe_.fd = __fd;
+      return __request;
+    }
+
+    inline auto io_uring_fdatasync(int __fd) noexcept -> io_uring_request {
+      io_uring_request __request = io_uring_fsync(__fd);
+      __request.__sqe_.fsync_flags = IORING_FSYNC_DATASYNC;
+      return __request;
+    }
+
+#    ifdef STDEXEC_HAS_IORING_OP_SPLICE
+    // Moves up to `__length` bytes from `__fd_in` to `__fd_out` without copying them through
+    // user space, like splice(2). One of the two has to be a pipe. An offset of -1 stands for
+    // the file position, and has to be used for pipes.
+    inline auto io_uring_splice(
+      int __fd_in,
+      std::uint64_t __offset_in,
+      int __fd_out,
+      std::uint64_t __offset_out,
+      std::size_t __length,
+      unsigned __flags = 0) noexcept -> io_uring_request {
+      io_uring_request __request{};
+      __request.__sqe_.opcode = IORING_OP_SPLICE;
+      __request.__sqe_.splice_fd_in = __fd_in;
+      __request.__sqe_.splice_off_in = __offset_in;
+      __request.__sqe_.fd = __fd_out;
+      __request.__sqe_.off = __offset_out;
+      __request.__sqe_.len = static_cast<__u32>(__length);
+      __request.__sqe_.splice_flags = __flags;
+      return __request;
+    }
+
+    // Duplicates up to `__length` bytes from the pipe `__fd_in` into the pipe `__fd_out`
+    // without consuming them, like tee(2).
+    inline auto io_uring_tee(int __fd_in, int __fd_out, std::size_t __length, unsigned __flags = 0)
+      noexcept -> io_uring_request {
+      io_uring_request __request{};
+      __request.__sqe_.opcode = IORING_OP_TEE;
+      __request.__sqe_.splice_fd_in = __fd_in;
+      __request.__sqe_.fd = __fd_out;
+      __request.__sqe_.len = static_cast<__u32>(__length);
+      __request.__sqe_.splice_flags = __flags;
+      return __request;
+    }
+#    endif
+
+    // Submits a chain of requests in one go. Each request is a task of its own, so that the
+    // kernel reports a result for each of them. All but the last request carry the link flag,
+    // which makes the kernel start a request only once the one before it has completed.
+    template <class _ReceiverId, std::size_t _Np>
+    struct __submit_operation {
+      using _Receiver = stdexec::__t<_ReceiverId>;
+
+      class __t : stdexec::__immovable {
+        struct __step : __task {
+          __t* __op_;
+          int __res_{0};
+
+          static auto __ready_(__task*) noexcept -> bool {
+            return false;
+          }
+
+          static void __submit_(__task* __pointer, ::io_uring_sqe& __sqe) noexcept {
+            auto* __self = static_cast<__step*>(__pointer);
+            __self->__op_->__submit(*__self, __sqe);
+          }
+
+          static void __complete_(__task* __pointer, const ::io_uring_cqe& __cqe) noexcept {
+            auto* __self = static_cast<__step*>(__pointer);
+            __self->__res_ = __cqe.res;
+            __self->__op_->__arrive();
+          }
+
+          static constexpr __task_vtable __vtable{&__ready_, &__submit_, &__complete_};
+
+          explicit __step(__t* __op) noexcept
+            : __task{__vtable}
+            , __op_{__op} {
+          }
+        };
+
+#    ifdef STDEXEC_HAS_IO_URING_ASYNC_CANCELLATION
+        struct __cancel : __task {
+          __t* __op_;
+          __task* __target_;
+
+          static auto __ready_(__task*) noexcept -> bool {
+            return false;
+          }
+
+          static void __submit_(__task* __pointer, ::io_uring_sqe& __sqe) noexcept {
+            auto* __self = static_cast<__cancel*>(__pointer);
+            __sqe = ::io_uring_sqe{};
+            __sqe.opcode = IORING_OP_ASYNC_CANCEL;
+            __sqe.addr = bit_cast<__u64>(__self->__target_);
+          }
+
+          static void __complete_(__task* __pointer, const ::io_uring_cqe&) noexcept {
+            static_cast<__cancel*>(__pointer)->__op_->__arrive();
+          }
+
+          static constexpr __task_vtable __vtable{&__ready_, &__submit_, &__complete_};
+
+          __cancel(__t* __op, __task* __target) noexcept
+            : __task{__vtable}
+            , __op_{__op}
+            , __target_{__target} {
+          }
+        };
+
+        struct __stop_callback {
+          __t* __self_;
+
+          void operator()() noexcept {
+            __self_->__request_stop();
+          }
+        };
+
+        using __on_context_stop_t = std::optional<stdexec::inplace_stop_callback<__stop_callback>>;
+        using __on_receiver_stop_t = std::optional<typename stdexec::stop_token_of_t<
+          stdexec::env_of_t<_Receiver>&>::template callback_type<__stop_callback>>;
+#    endif
+
+        template <std::size_t... _Is>
+        auto __make_steps(std::index_sequence<_Is...>) noexcept -> std::array<__step, _Np> {
+          return {((void) _Is, __step{this})...};
+        }
+
+#    ifdef STDEXEC_HAS_IO_URING_ASYNC_CANCELLATION
+        template <std::size_t... _Is>
+        auto __make_cancels(std::index_sequence<_Is...>) noexcept -> std::array<__cancel, _Np> {
+          return {__cancel{this, &__steps_[_Is]}...};
+        }
+#    endif
+
+        void __submit(__step& __step, ::io_uring_sqe& __sqe) noexcept {
+          const auto __index = static_cast<std::size_t>(&__step - __steps_.data());
+#    ifdef STDEXEC_HAS_IO_URING_ASYNC_CANCELLATION
+          if (__index == 0) {
+            __on_context_stop_.emplace(__context_.get_stop_token(), __stop_callback{this});
+            __on_receiver_stop_.emplace(
+              stdexec::get_stop_token(stdexec::get_env(__receiver_)), __stop_callback{this});
+          }
+#    endif
+          __sqe = __requests_[__index];
+          if (__index + 1 < _Np) {
+            __sqe.flags |= __link_flag_;
+          }
+        }
+
+#    ifdef STDEXEC_HAS_IO_URING_ASYNC_CANCELLATION
+        // Cancels every request of the chain that has not completed yet. Each cancellation
+        // completes like a request, so the operation waits for them as well.
+        void __request_stop() noexcept {
+          if (__stop_requested_.exchange(true, std::memory_order_relaxed)) {
+            return;
+          }
+          int __n = __n_ops_.load(std::memory_order_relaxed);
+          do {
+            if (__n == 0) {
+              return;
+            }
+          } while (!__n_ops_.compare_exchange_weak(
+            __n, __n + static_cast<int>(_Np), std::memory_order_relaxed));
+          bool __wakeup = false;
+          for (__cancel& __cancel : __cancels_) {
+            __wakeup = __context_.submit(&__cancel) || __wakeup;
+          }
+          if (__wakeup) {
+            __context_.wakeup();
+          }
+        }
+#    endif
+
+        void __arrive() noexcept {
+          if (__n_ops_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            __complete(std::make_index_sequence<_Np>{});
+          }
+        }
+
+        template <std::size_t... _Is>
+        void __complete(std::index_sequence<_Is...>) noexcept {
+#    ifdef STDEXEC_HAS_IO_URING_ASYNC_CANCELLATION
+          __on_context_stop_.reset();
+          __on_receiver_stop_.reset();
+#    endif
+          // A request of a broken chain completes with -ECANCELED. Report the request that
+          // failed rather than the ones that were cancelled because of it.
+          int __error = 0;
+          bool __cancelled = false;
+          for (const __step& __step: __steps_) {
+            if (__step.__res_ == -ECANCELED) {
+              __cancelled = true;
+            } else if (__step.__res_ < 0 && __error == 0) {
+              __error = -__step.__res_;
+            }
+          }
+          if (__cancelled && __error == 0) {
+            auto __token = stdexec::get_stop_token(stdexec::get_env(__receiver_));
+            if (__context_.stop_requested() || __token.stop_requested()) {
+              stdexec::set_stopped(static_cast<_Receiver&&>(__receiver_));
+              return;
+            }
+            // The chain broke on a short read or write, which the kernel does not report as an
+            // error of its own.
+            __error = ECANCELED;
+          }
+          if (__error != 0) {
+            stdexec::set_error(
+              static_cast<_Receiver&&>(__receiver_),
+              std::make_exception_ptr(std::system_error(__error, std::system_category())));
+          } else {
+            stdexec::set_value(
+              static_cast<_Receiver&&>(__receiver_),
+              static_cast<std::size_t>(__steps_[_Is].__res_)...);
+          }
+        }
+
+        __context& __context_;
+        STDEXEC_ATTRIBUTE((no_unique_address)) _Receiver __receiver_;
+        std::array<::io_uring_sqe, _Np> __requests_;
+        __u8 __link_flag_;
+        std::array<__step, _Np> __steps_;
+        std::atomic<int> __n_ops_{static_cast<int>(_Np)};
+#    ifdef STDEXEC_HAS_IO_URING_ASYNC_CANCELLATION
+        std::array<__cancel, _Np> __cancels_;
+        std::atomic<bool> __stop_requested_{false};
+        __on_context_stop_t __on_context_stop_{};
+        __on_receiver_stop_t __on_receiver_stop_{};
+#    endif
+
+       public:
+        __t(
+          __context& __context,
+          const std::array<::io_uring_sqe, _Np>& __requests,
+          __u8 __link_flag,
+          _Receiver&& __receiver)
+          : __context_{__context}
+          , __receiver_{static_cast<_Receiver&&>(__receiver)}
+          , __requests_{__requests}
+          , __link_flag_{__link_flag}
+          , __steps_{__make_steps(std::make_index_sequence<_Np>{})}
+#    ifdef STDEXEC_HAS_IO_URING_ASYNC_CANCELLATION
+          , __cancels_{__make_cancels(std::make_index_sequence<_Np>{})}
+#    endif
+        {
+          for (std::size_t __i = 0; __i + 1 < _Np; ++__i) {
+            __steps_[__i].__link_next_ = &__steps_[__i + 1];
+          }
+        }
+
+        void start() & noexcept {
+          if (__context_.submit(&__steps_[0])) {
+            __context_.wakeup();
+          }
+        }
+      };
+    };
+
+#    ifdef STDEXEC_HAS_IORING_OP_SEND
+    // Sends data on a socket. A zero-copy send completes twice: once with the number of bytes
+    // sent and, if that completion carries IORING_CQE_F_MORE, once more with IORING_CQE_F_NOTIF
+    // when the kernel releases the buffer. Both completions are delivered to this task, so the
+    // operation completes with the byte count only after the buffer has been released.
+    template <class _ReceiverId>
+    struct __send_operation {
+      using _Receiver = stdexec::__t<_ReceiverId>;
+
+      class __t : public __task {
+        static auto __ready_(__task*) noexcept -> bool {
+          return false;
+        }
+
+        static void __submit_(__task* __pointer, ::io_uring_sqe& __sqe) noexcept {
+          auto* __self = static_cast<__t*>(__pointer);
+#      ifdef STDEXEC_HAS_IO_URING_ASYNC_CANCELLATION
+          if (!__self->__on_context_stop_) {
+            __self->__on_context_stop_.emplace(
+              __self->__context_.get_stop_token(), __stop_callback{__self});
+            __self->__on_receiver_stop_.emplace(
+              stdexec::get_stop_token(stdexec::get_env(__self->__receiver_)),
+              __stop_callback{__self});
+          }
+#      endif
+          __sqe = __self->__request_;
+        }
+
+        static void __complete_(__task* __pointer, const ::io_uring_cqe& __cqe) noexcept {
+          auto* __self = static_cast<__t*>(__pointer);
+#      ifdef STDEXEC_HAS_IORING_OP_SEND_ZC
+          if (__cqe.flags & IORING_CQE_F_NOTIF) {
+            if (std::exchange(__self->__resubmit_on_notification_, false)) {
+              __self->__context_.submit(__self);
+            } else {
+              __self->__arrive();
+            }
+            return;
+          }
+          if (
+            (__cqe.res == -EINVAL || __cqe.res == -EOPNOTSUPP) && __self->__fall_back_to_copy()) {
+            // The run loop submits the request again right after this completion, or after the
+            // notification if the failed request still has one to deliver.
+            if (__cqe.flags & IORING_CQE_F_MORE) {
+              __self->__resubmit_on_notification_ = true;
+            } else {
+              __self->__context_.submit(__self);
+            }
+            return;
+          }
+          __self->__res_ = __cqe.res;
+          if (!(__cqe.flags & IORING_CQE_F_MORE)) {
+            __self->__arrive();
+          }
+#      else
+          __self->__res_ = __cqe.res;
+          __self->__arrive();
+#      endif
+        }
+
+        static constexpr __task_vtable __vtable{&__ready_, &__submit_, &__complete_};
+
+#      ifdef STDEXEC_HAS_IORING_OP_SEND_ZC
+        // Turns a zero-copy request that the kernel or the socket does not support into a
+        // regular one. Returns false if the request was not a zero-copy one.
+        auto __fall_back_to_copy() noexcept -> bool {
+          switch (__request_.opcode) {
+          case IORING_OP_SEND_ZC:
+            __request_.opcode = IORING_OP_SEND;
+            break;
+          case IORING_OP_SENDMSG_ZC:
+            __request_.opcode = IORING_OP_SENDMSG;
+            break;
+          default:
+            return false;
+          }
+          __request_.ioprio = 0;
+          return true;
+        }
+#      endif
+
+#      ifdef STDEXEC_HAS_IO_URING_ASYNC_CANCELLATION
+        struct __cancel : __task {
+          __t* __op_;
+
+          static auto __ready_(__task*) noexcept -> bool {
+            return false;
+          }
+
+          static void __submit_(__task* __pointer, ::io_uring_sqe& __sqe) noexcept {
+            auto* __self = static_cast<__cancel*>(__pointer);
+            __sqe = ::io_uring_sqe{};
+            __sqe.opcode = IORING_OP_ASYNC_CANCEL;
+            __sqe.addr = bit_cast<__u64>(static_cast<__task*>(__self->__op_));
+          }
+
+          static void __complete_(__task* __pointer, const ::io_uring_cqe&) noexcept {
+            static_cast<__cancel*>(__pointer)->__op_->__arrive();
+          }
+
+          static constexpr __task_vtable __vtable{&__ready_, &__submit_, &__complete_};
+
+          explicit __cancel(__t* __op) noexcept
+            : __task{__vtable}
+            , __op_{__op} {
+          }
+        };
+
+        struct __stop_callback {
+          __t* __self_;
+
+          void operator()() noexcept {
+            __self_->__request_stop();
+          }
+        };
+
+        using __on_context_stop_t = std::optional<stdexec::inplace_stop_callback<__stop_callback>>;
+        using __on_receiver_stop_t = std::optional<typename stdexec::stop_token_of_t<
+          stdexec::env_of_t<_Receiver>&>::template callback_type<__stop_callback>>;
+
+        void __request_stop() noexcept {
+          int __n = __n_ops_.load(std::memory_order_relaxed);
+          do {
+            if (__n != 1) {
+              return;
+            }
+          } while (!__n_ops_.compare_exchange_weak(__n, 2, std::memory_order_relaxed));
+          if (__context_.submit(&__cancel_)) {
+            __context_.wakeup();
+          }
+        }
+#      endif
+
+        void __arrive() noexcept {
+          if (__n_ops_.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+            return;
+          }
+#      ifdef STDEXEC_HAS_IO_URING_ASYNC_CANCELLATION
+          __on_context_stop_.reset();
+          __on_receiver_stop_.reset();
+#      endif
+          if (__res_ == -ECANCELED) {
+            stdexec::set_stopped(static_cast<_Receiver&&>(__receiver_));
+          } else if (__res_ < 0) {
+            stdexec::set_error(
+              static_cast<_Receiver&&>(__receiver_),
+              std::make_exception_ptr(std::system_error(-__res_, std::system_category())));
+          } else {
+            stdexec::set_value(
+              static_cast<_Receiver&&>(__receiver_), static_cast<std::size_t>(__res_));
+          }
+        }
+
+        __context& __context_;
+        STDEXEC_ATTRIBUTE((no_unique_address)) _Receiver __receiver_;
+        ::io_uring_sqe __request_;
+        int __res_{0};
+        std::atomic<int> __n_ops_{1};
+#      ifdef STDEXEC_HAS_IORING_OP_SEND_ZC
+        bool __resubmit_on_notification_{false};
+#      endif
+#      ifdef STDEXEC_HAS_IO_URING_ASYNC_CANCELLATION
+        __cancel __cancel_{this};
+        __on_context_stop_t __on_context_stop_{};
+        __on_receiver_stop_t __on_receiver_stop_{};
+#      endif
+
+       public:
+        __t(__context& __context, const ::io_uring_sqe& __request, _Receiver&& __receiver)
+          : __task{__vtable}
+          , __context_{__context}
+          , __receiver_{static_cast<_Receiver&&>(__receiver)}
+          , __request_{__request} {
+        }
+
+        void start() & noexcept {
+          if (__context_.submit(this)) {
+            __context_.wakeup();
+          }
+        }
+      };
+    };
+#    endif
+
+#    ifdef STDEXEC_HAS_IORING_OP_SPLICE
+    // Streams part of a file to a socket through a pipe, so that the data never passes through
+    // user space. Each step splices a chunk of the file into the pipe and then splices the pipe
+    // into the socket until it is empty again. The task submits one splice at a time and
+    // submits itself again from the completion of the previous one.
+    template <class _ReceiverId>
+    struct __transfer_file_operation {
+      using _Receiver = stdexec::__t<_ReceiverId>;
+
+      class __t : public __task {
+        // The default capacity of a pipe. The kernel moves less if the pipe is smaller.
+        static constexpr std::size_t __max_chunk = 1 << 16;
+
+        static auto __ready_(__task*) noexcept -> bool {
+          return false;
+        }
+
+        static void __submit_(__task* __pointer, ::io_uring_sqe& __sqe) noexcept {
+          auto* __self = static_cast<__t*>(__pointer);
+          if (!__self->__on_context_stop_) {
+            __self->__on_context_stop_.emplace(
+              __self->__context_.get_stop_token(), __stop_callback{__self});
+            __self->__on_receiver_stop_.emplace(
+              stdexec::get_stop_token(stdexec::get_env(__self->__receiver_)),
+              __stop_callback{__self});
+          }
+          if (__self->__in_pipe_ == 0) {
+            __sqe = io_uring_splice(
+                      __self->__file_,
+                      __self->__offset_,
+                      __self->__pipe_write_end_,
+                      static_cast<std::uint64_t>(-1),
+                      (std::min) (__self->__remaining_, __max_chunk),
+                      SPLICE_F_MOVE)
+                      .__sqe_;
+          } else {
+            __sqe = io_uring_splice(
+                      __self->__pipe_read_end_,
+                      static_cast<std::uint64_t>(-1),
+                      __self->__socket_,
+                      static_cast<std::uint64_t>(-1),
+                      __self->__in_pipe_,
+                      SPLICE_F_MOVE)
+                      .__sqe_;
+          }
+        }
+
+        static void __complete_(__task* __pointer, const ::io_uring_cqe& __cqe) noexcept {
+          auto* __self = static_cast<__t*>(__pointer);
+          const bool __stop_requested = __self->__stop_requested_.load(std::memory_order_acquire);
+          if (__cqe.res < 0) {
+            // A splice that blocks in a kernel worker fails with an interrupted system call
+            // rather than -ECANCELED when it is cancelled.
+            __self->__res_ = __stop_requested ? -ECANCELED : __cqe.res;
+            __self->__arrive();
+            return;
+          }
+          const auto __n = static_cast<std::size_t>(__cqe.res);
+          if (__self->__in_pipe_ == 0) {
+            // Nothing was spliced into the pipe at the end of the file.
+            __self->__remaining_ = __n == 0 ? 0 : __self->__remaining_ - __n;
+            __self->__offset_ += __n;
+            __self->__in_pipe_ = __n;
+          } else {
+            __self->__in_pipe_ -= __n;
+            __self->__transferred_ += __n;
+          }
+          if (__stop_requested) {
+            __self->__res_ = -ECANCELED;
+            __self->__arrive();
+          } else if (__self->__in_pipe_ == 0 && __self->__remaining_ == 0) {
+            __self->__arrive();
+          } else {
+            // The run loop submits the next splice right after this completion. This may
+            // complete the operation inline if the context is stopping.
+            __self->__context_.submit(__self);
+          }
+        }
+
+        static constexpr __task_vtable __vtable{&__ready_, &__submit_, &__complete_};
+
+        struct __cancel : __task {
+          __t* __op_;
+
+          static auto __ready_(__task*) noexcept -> bool {
+            return false;
+          }
+
+          static void __submit_(__task* __pointer, ::io_uring_sqe& __sqe) noexcept {
+            auto* __self = static_cast<__cancel*>(__pointer);
+            __sqe = ::io_uring_sqe{};
+            __sqe.opcode = IORING_OP_ASYNC_CANCEL;
+            __sqe.addr = bit_cast<__u64>(static_cast<__task*>(__self->__op_));
+          }
+
+          static void __complete_(__task* __pointer, const ::io_uring_cqe&) noexcept {
+            static_cast<__cancel*>(__pointer)->__op_->__arrive();
+          }
+
+          static constexpr __task_vtable __vtable{&__ready_, &__submit_, &__complete_};
+
+          explicit __cancel(__t* __op) noexcept
+            : __task{__vtable}
+            , __op_{__op} {
+          }
+        };
+
+        struct __stop_callback {
+          __t* __self_;
+
+          void operator()() noexcept {
+            __self_->__request_stop();
+          }
+        };
+
+        using __on_context_stop_t = std::optional<stdexec::inplace_stop_callback<__stop_callback>>;
+        using __on_receiver_stop_t = std::optional<typename stdexec::stop_token_of_t<
+          stdexec::env_of_t<_Receiver>&>::template callback_type<__stop_callback>>;
+
+        // Cancels the splice in flight. If there is none, the operation stops once the current
+        // one completes.
+        void __request_stop() noexcept {
+          __stop_requested_.store(true, std::memory_order_release);
+          int __n = __n_ops_.load(std::memory_order_relaxed);
+          do {
+            if (__n != 1) {
+              return;
+            }
+          } while (!__n_ops_.compare_exchange_weak(__n, 2, std::memory_order_relaxed));
+          if (__context_.submit(&__cancel_)) {
+            __context_.wakeup();
+          }
+        }
+
+        void __arrive() noexcept {
+          if (__n_ops_.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+            return;
+          }
+          __on_context_stop_.reset();
+          __on_receiver_stop_.reset();
+          if (__res_ == -ECANCELED) {
+            stdexec::set_stopped(static_cast<_Receiver&&>(__receiver_));
+          } else if (__res_ < 0) {
+            stdexec::set_error(
+              static_cast<_Receiver&&>(__receiver_),
+              std::make_exception_ptr(std::system_error(-__res_, std::system_category())));
+          } else {
+            stdexec::set_value(static_cast<_Receiver&&>(__receiver_), std::size_t{__transferred_});
+          }
+        }
+
+        __context& __context_;
+        STDEXEC_ATTRIBUTE((no_unique_address)) _Receiver __receiver_;
+        int __file_;
+        int __socket_;
+        std::uint64_t __offset_;
+        std::size_t __remaining_;
+        std::size_t __in_pipe_{0};
+        std::size_t __transferred_{0};
+        int __res_{0};
+        safe_file_descriptor __pipe_read_end_{};
+        safe_file_descriptor __pipe_write_end_{};
+        std::atomic<int> __n_ops_{1};
+        std::atomic<bool> __stop_requested_{false};
+        __cancel __cancel_{this};
+        __on_context_stop_t __on_context_stop_{};
+        __on_receiver_stop_t __on_receiver_stop_{};
+
+       public:
+        __t(
+          __context& __context,
+          int __file,
+          int __socket,
+          std::uint64_t __offset,
+          std::size_t __count,
+          _Receiver&& __receiver)
+          : __task{__vtable}
+          , __context_{__context}
+          , __receiver_{static_cast<_Receiver&&>(__receiver)}
+          , __file_{__file}
+          , __socket_{__socket}
+          , __offset_{__offset}
+          , __remaining_{__count} {
+        }
+
+        void start() & noexcept {
+          if (__remaining_ == 0) {
+            stdexec::set_value(static_cast<_Receiver&&>(__receiver_), std::size_t{0});
+            return;
+          }
+          int __fds[2];
+          if (::pipe2(__fds, O_CLOEXEC) != 0) {
+            stdexec::set_error(
+              static_cast<_Receiver&&>(__receiver_),
+              std::make_exception_ptr(std::system_error(errno, std::system_category())));
+            return;
+          }
+          __pipe_read_end_ = safe_file_descriptor{__fds[0]};
+          __pipe_write_end_ = safe_file_descriptor{__fds[1]};
+          if (__context_.submit(this)) {
+            __context_.wakeup();
+          }
+        }
+      };
+    };
+#    endif
+
     class __scheduler {
      public:
       __context* __context_;
@@ -1137,10 +2037,350 @@ namespace exec {
         }
       };
 
+      template <std::size_t _Np>
+      class __submit_sender {
+        template <std::size_t>
+        using __result_t = std::size_t;
+
+        template <std::size_t... _Is>
+        static auto __completion_sigs_of(std::index_sequence<_Is...>)
+          -> stdexec::completion_signatures<
+            stdexec::set_value_t(__result_t<_Is>...),
+            stdexec::set_error_t(std::exception_ptr),
+            stdexec::set_stopped_t()>;
+
+        using __completion_sigs = decltype(__completion_sigs_of(std::make_index_sequence<_Np>{}));
+
+       public:
+        using sender_concept = stdexec::sender_t;
+        using __id = __submit_sender;
+        using __t = __submit_sender;
+
+        __schedule_env __env_;
+        std::array<::io_uring_sqe, _Np> __requests_;
+        __u8 __link_flag_;
+
+        auto get_env() const noexcept -> __schedule_env {
+          return __env_;
+        }
+
+        template <class... _Env>
+        static auto get_completion_signatures(const __submit_sender&, _Env&&...) noexcept
+          -> __completion_sigs {
+          return {};
+        }
+
+        template <stdexec::receiver_of<__completion_sigs> _Receiver>
+        auto connect(_Receiver __receiver) const & //
+          -> stdexec::__t<__submit_operation<stdexec::__id<_Receiver>, _Np>> {
+          return {
+            *__env_.__context_, __requests_, __link_flag_, static_cast<_Receiver&&>(__receiver)};
+        }
+      };
+
+#    ifdef STDEXEC_HAS_IORING_OP_SEND
+      template <class... _Values>
+      class __io_request_sender {
+        using __completion_sigs = stdexec::completion_signatures<
+          stdexec::set_value_t(_Values...),
+          stdexec::set_error_t(std::exception_ptr),
+          stdexec::set_stopped_t()>;
+
+       public:
+        using sender_concept = stdexec::sender_t;
+        using __id = __io_request_sender;
+        using __t = __io_request_sender;
+
+        __schedule_env __env_;
+        ::io_uring_sqe __request_;
+
+        auto get_env() const noexcept -> __schedule_env {
+          return __env_;
+        }
+
+        template <class... _Env>
+        static auto get_completion_signatures(const __io_request_sender&, _Env&&...) noexcept
+          -> __completion_sigs {
+          return {};
+        }
+
+        template <stdexec::receiver_of<__completion_sigs> _Receiver>
+        auto connect(_Receiver __receiver) const & //
+          -> stdexec::__t<__io_request_operation<stdexec::__id<_Receiver>, _Values...>> {
+          return stdexec::__t<__io_request_operation<stdexec::__id<_Receiver>, _Values...>>(
+            std::in_place, *__env_.__context_, __request_, static_cast<_Receiver&&>(__receiver));
+        }
+      };
+
+      class __close_sender {
+        using __completion_sigs = stdexec::completion_signatures<
+          stdexec::set_value_t(),
+          stdexec::set_error_t(std::exception_ptr),
+          stdexec::set_stopped_t()>;
+
+       public:
+        using sender_concept = stdexec::sender_t;
+        using __id = __close_sender;
+        using __t = __close_sender;
+
+        __schedule_env __env_;
+        int __fd_;
+
+        auto get_env() const noexcept -> __schedule_env {
+          return __env_;
+        }
+
+        template <class... _Env>
+        static auto get_completion_signatures(const __close_sender&, _Env&&...) noexcept
+          -> __completion_sigs {
+          return {};
+        }
+
+        template <stdexec::receiver_of<__completion_sigs> _Receiver>
+        auto connect(_Receiver __receiver) const & //
+          -> stdexec::__t<__close_operation<stdexec::__id<_Receiver>>> {
+          return stdexec::__t<__close_operation<stdexec::__id<_Receiver>>>(
+            std::in_place, *__env_.__context_, __fd_, static_cast<_Receiver&&>(__receiver));
+        }
+      };
+
+      class __send_sender {
+        using __completion_sigs = stdexec::completion_signatures<
+          stdexec::set_value_t(std::size_t),
+          stdexec::set_error_t(std::exception_ptr),
+          stdexec::set_stopped_t()>;
+
+       public:
+        using sender_concept = stdexec::sender_t;
+        using __id = __send_sender;
+        using __t = __send_sender;
+
+        __schedule_env __env_;
+        ::io_uring_sqe __request_;
+
+        auto get_env() const noexcept -> __schedule_env {
+          return __env_;
+        }
+
+        template <class... _Env>
+        static auto get_completion_signatures(const __send_sender&, _Env&&...) noexcept
+          -> __completion_sigs {
+          return {};
+        }
+
+        template <stdexec::receiver_of<__completion_sigs> _Receiver>
+        auto connect(_Receiver __receiver) const & //
+          -> stdexec::__t<__send_operation<stdexec::__id<_Receiver>>> {
+          return {*__env_.__context_, __request_, static_cast<_Receiver&&>(__receiver)};
+        }
+      };
+
+      static auto __send_request(__u8 __opcode, int __fd, __u64 __addr, __u32 __len, int __flags)
+        noexcept -> ::io_uring_sqe {
+        ::io_uring_sqe __sqe{};
+#      ifdef STDEXEC_HAS_IORING_OP_SEND_ZC
+        __sqe.opcode = __opcode == IORING_OP_SEND ? IORING_OP_SEND_ZC : IORING_OP_SENDMSG_ZC;
+#      else
+        __sqe.opcode = __opcode;
+#      endif
+        __sqe.fd = __fd;
+        __sqe.addr = __addr;
+        __sqe.len = __len;
+        __sqe.msg_flags = static_cast<__u32>(__flags);
+        return __sqe;
+      }
+#    endif
+
+#    ifdef STDEXEC_HAS_IORING_OP_SPLICE
+      class __transfer_file_sender {
+        using __completion_sigs = stdexec::completion_signatures<
+          stdexec::set_value_t(std::size_t),
+          stdexec::set_error_t(std::exception_ptr),
+          stdexec::set_stopped_t()>;
+
+       public:
+        using sender_concept = stdexec::sender_t;
+        using __id = __transfer_file_sender;
+        using __t = __transfer_file_sender;
+
+        __schedule_env __env_;
+        int __file_;
+        int __socket_;
+        std::uint64_t __offset_;
+        std::size_t __count_;
+
+        auto get_env() const noexcept -> __schedule_env {
+          return __env_;
+        }
+
+        template <class... _Env>
+        static auto get_completion_signatures(const __transfer_file_sender&, _Env&&...) noexcept
+          -> __completion_sigs {
+          return {};
+        }
+
+        template <stdexec::receiver_of<__completion_sigs> _Receiver>
+        auto connect(_Receiver __receiver) const & //
+          -> stdexec::__t<__transfer_file_operation<stdexec::__id<_Receiver>>> {
+          return {
+            *__env_.__context_,
+            __file_,
+            __socket_,
+            __offset_,
+            __count_,
+            static_cast<_Receiver&&>(__receiver)};
+        }
+      };
+#    endif
+
       auto schedule() const -> __schedule_sender {
         return __schedule_sender{__schedule_env{__context_}};
       }
 
+      //! Submits `__request` and completes with its result, the number of bytes transferred
+      //! for reads and writes.
+      auto submit(const io_uring_request& __request) const -> __submit_sender<1> {
+        return {{__context_}, {__request.__sqe_}, 0};
+      }
+
+      //! Submits the requests as a linked chain: the kernel starts each request once the one
+      //! before it has completed, without a round trip through the run loop in between. A
+      //! request that fails, or reads or writes less than asked for, cancels the rest of the
+      //! chain. Completes with the result of each request.
+      template <stdexec::same_as<io_uring_request>... _Requests>
+      auto submit_linked(const io_uring_request& __first, const _Requests&... __rest) const
+        -> __submit_sender<1 + sizeof...(_Requests)> {
+        return {{__context_}, {__first.__sqe_, __rest.__sqe_...}, IOSQE_IO_LINK};
+      }
+
+#    ifdef STDEXEC_HAS_IO_URING_ASYNC_CANCELLATION
+      //! Like `submit_linked`, except that a failed request does not cancel the rest of the
+      //! chain. The operation still completes with the first error.
+      template <stdexec::same_as<io_uring_request>... _Requests>
+      auto submit_hardlinked(const io_uring_request& __first, const _Requests&... __rest) const
+        -> __submit_sender<1 + sizeof...(_Requests)> {
+        return {{__context_}, {__first.__sqe_, __rest.__sqe_...}, IOSQE_IO_HARDLINK};
+      }
+#    endif
+
+#    ifdef STDEXEC_HAS_IORING_OP_SEND
+      //! Sends `__buffer` on the socket `__fd` and completes with the number of bytes sent.
+      //! Where the kernel and the socket support it, the data is sent without copying it, and
+      //! the operation completes only once the kernel no longer uses `__buffer`. Either way the
+      //! buffer can be reused as soon as the operation completes.
+      auto async_send(int __fd, std::span<const std::byte> __buffer, int __flags = 0) const
+        -> __send_sender {
+        return {
+          {__context_},
+          __send_request(
+            IORING_OP_SEND,
+            __fd,
+            bit_cast<__u64>(__buffer.data()),
+            static_cast<__u32>(__buffer.size()),
+            __flags)};
+      }
+
+      //! Like `async_send`, for the message `__msg`, which has to outlive the operation.
+      auto async_sendmsg(int __fd, const ::msghdr& __msg, int __flags = 0) const -> __send_sender {
+        return {
+          {__context_},
+          __send_request(IORING_OP_SENDMSG, __fd, bit_cast<__u64>(&__msg), 1, __flags)};
+      }
+
+      //! Connects the socket `__fd` to `__address`, which has to outlive the operation.
+      auto async_connect(int __fd, const ::sockaddr* __address, ::socklen_t __length) const
+        -> __io_request_sender<> {
+        ::io_uring_sqe __sqe{};
+        __sqe.opcode = IORING_OP_CONNECT;
+        __sqe.fd = __fd;
+        __sqe.addr = bit_cast<__u64>(__address);
+        __sqe.off = __length;
+        return {{__context_}, __sqe};
+      }
+
+      //! Accepts a connection on the listening socket `__fd` and completes with the socket of
+      //! the connection. If `__address` is given, the address of the peer is stored there and
+      //! its length in `*__length`, which holds the size of `*__address` on input.
+      auto async_accept(
+        int __fd,
+        ::sockaddr* __address = nullptr,
+        ::socklen_t* __length = nullptr,
+        int __flags = SOCK_CLOEXEC) const -> __io_request_sender<int> {
+        ::io_uring_sqe __sqe{};
+        __sqe.opcode = IORING_OP_ACCEPT;
+        __sqe.fd = __fd;
+        __sqe.addr = bit_cast<__u64>(__address);
+        __sqe.addr2 = bit_cast<__u64>(__length);
+        __sqe.accept_flags = static_cast<__u32>(__flags);
+        return {{__context_}, __sqe};
+      }
+
+      //! Receives into `__buffer` from the socket `__fd` and completes with the number of bytes
+      //! received, which is zero once the peer has shut down the connection.
+      auto async_recv(int __fd, std::span<std::byte> __buffer, int __flags = 0) const
+        -> __io_request_sender<std::size_t> {
+        ::io_uring_sqe __sqe{};
+        __sqe.opcode = IORING_OP_RECV;
+        __sqe.fd = __fd;
+        __sqe.addr = bit_cast<__u64>(__buffer.data());
+        __sqe.len = static_cast<__u32>(__buffer.size());
+        __sqe.msg_flags = static_cast<__u32>(__flags);
+        return {{__context_}, __sqe};
+      }
+
+      //! Closes the file descriptor `__fd`. A stop request does not interrupt the close, so
+      //! the descriptor is closed whenever the operation completes with a value.
+      auto async_close(int __fd) const -> __close_sender {
+        return {{__context_}, __fd};
+      }
+
+#      ifdef STDEXEC_HAS_IORING_OP_SHUTDOWN
+      //! Shuts down the reading side, the writing side or both sides of the socket `__fd`, as
+      //! selected by `__how`, one of `SHUT_RD`, `SHUT_WR` and `SHUT_RDWR`.
+      auto async_shutdown(int __fd, int __how) const -> __io_request_sender<> {
+        ::io_uring_sqe __sqe{};
+        __sqe.opcode = IORING_OP_SHUTDOWN;
+        __sqe.fd = __fd;
+        __sqe.len = static_cast<__u32>(__how);
+        return {{__context_}, __sqe};
+      }
+#      endif
+
+#    ifdef STDEXEC_HAS_IORING_OP_SPLICE
+      //! Moves up to `__length` bytes from `__fd_in` to `__fd_out`, one of which has to be a
+      //! pipe, and completes with the number of bytes moved. See `io_uring_splice`.
+      auto async_splice(
+        int __fd_in,
+        int __fd_out,
+        std::size_t __length,
+        std::uint64_t __offset_in = static_cast<std::uint64_t>(-1),
+        std::uint64_t __offset_out = static_cast<std::uint64_t>(-1),
+        unsigned __flags = 0) const -> __io_request_sender<std::size_t> {
+        return {
+          {__context_},
+          io_uring_splice(__fd_in, __offset_in, __fd_out, __offset_out, __length, __flags).__sqe_};
+      }
+
+      //! Duplicates up to `__length` bytes from the pipe `__fd_in` into the pipe `__fd_out`
+      //! and completes with the number of bytes duplicated. See `io_uring_tee`.
+      auto async_tee(int __fd_in, int __fd_out, std::size_t __length, unsigned __flags = 0) const
+        -> __io_request_sender<std::size_t> {
+        return {{__context_}, io_uring_tee(__fd_in, __fd_out, __length, __flags).__sqe_};
+      }
+
+      //! Sends `__count` bytes of the file `__file`, starting at `__offset`, on the socket
+      //! `__socket` through a pipe, like sendfile(2). Completes with the number of bytes sent,
+      //! which is less than `__count` if the file ends first.
+      auto async_transfer_file(
+        int __file,
+        int __socket,
+        std::uint64_t __offset,
+        std::size_t __count) const -> __transfer_file_sender {
+        return {{__context_}, __file, __socket, __offset, __count};
+      }
+#    endif
+#    endif
+
       friend auto tag_invoke(exec::now_t, const __scheduler&) noexcept
         -> std::chrono::time_point<std::chrono::steady_clock> {
         return std::chrono::steady_clock::now();
@@ -1171,6 +2411,17 @@ namespace exec {
   using __io_uring::until;
   using io_uring_context = __io_uring::__context;
   using io_uring_scheduler = __io_uring::__scheduler;
+  using __io_uring::io_uring_request;
+#    ifdef STDEXEC_HAS_IORING_OP_READ
+  using __io_uring::io_uring_read;
+  using __io_uring::io_uring_write;
+#    endif
+  using __io_uring::io_uring_fsync;
+  using __io_uring::io_uring_fdatasync;
+#    ifdef STDEXEC_HAS_IORING_OP_SPLICE
+  using __io_uring::io_uring_splice;
+  using __io_uring::io_uring_tee;
+#    endif
 } // namespace exec
 
 #  endif // if __has_include(<linux/verison.h>)
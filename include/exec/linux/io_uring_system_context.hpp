@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../../stdexec/execution.hpp"
+#include "../__detail/__system_context_default_impl.hpp"
+#include "./io_uring_context.hpp"
+
+#include <thread>
+
+namespace exec {
+  //! A backend for `exec::system_context` that waits for timers on an `io_uring_context`
+  //! rather than on a timer thread. Work, bulk work and the continuations of timers run on the
+  //! thread pool of the default backend.
+  //!
+  //! The backend is selected at run-time, within `main()` and before the system scheduler is
+  //! accessed:
+  //!
+  //!   static exec::io_uring_system_backend backend;
+  //!   system_context_replaceability::query_system_context<
+  //!     system_context_replaceability::__system_context_replaceability_v3>()
+  //!     ->__set_system_scheduler(&backend);
+  //!
+  //! Its ring is also available for asynchronous I/O through `get_io_scheduler()`.
+  class io_uring_system_backend : public __system_context_default_impl::__system_scheduler_impl {
+   public:
+    explicit io_uring_system_backend(unsigned __ring_entries = 1024)
+      : __io_context_{__ring_entries}
+      , __io_thread_{[this] { __io_context_.run_until_stopped(); }} {
+    }
+
+    ~io_uring_system_backend() override {
+      __io_context_.request_stop();
+      __io_thread_.join();
+    }
+
+    io_uring_system_backend(const io_uring_system_backend&) = delete;
+    io_uring_system_backend& operator=(const io_uring_system_backend&) = delete;
+
+    //! Returns the scheduler of the ring, which runs I/O operations and timers.
+    auto get_io_scheduler() noexcept -> io_uring_scheduler {
+      return __io_context_.get_scheduler();
+    }
+
+    void schedule_after(
+      std::chrono::steady_clock::duration __duration,
+      system_context_replaceability::storage __storage,
+      system_context_replaceability::timer_receiver* __r) noexcept override {
+      // The timer fires on the ring; the work runs on the pool.
+      __system_context_default_impl::__start_timer(
+        __storage,
+        __r,
+        stdexec::continues_on(
+          exec::schedule_after(get_io_scheduler(), __duration), __get_pool_scheduler()));
+    }
+
+    void schedule_at(
+      std::chrono::steady_clock::time_point __time_point,
+      system_context_replaceability::storage __storage,
+      system_context_replaceability::timer_receiver* __r) noexcept override {
+      __system_context_default_impl::__start_timer(
+        __storage,
+        __r,
+        stdexec::continues_on(
+          exec::schedule_at(get_io_scheduler(), __time_point), __get_pool_scheduler()));
+    }
+
+   private:
+    io_uring_context __io_context_;
+    std::thread __io_thread_;
+  };
+} // namespace exec
@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../stdexec/__detail/__config.hpp"
+#include "../stdexec/__detail/__intrusive_mpsc_queue.hpp"
+#include "../stdexec/__detail/__utility.hpp"
+
+#include "./__detail/__numa.hpp"
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <utility>
+
+namespace exec {
+  namespace __op_alloc {
+    // Every block starts with a header that names the cache that owns it, which keeps the payload
+    // aligned to 16 bytes. Blocks come in power-of-two size classes from 32 bytes to 4 KiB and are
+    // carved out of 64 KiB chunks.
+    inline constexpr std::size_t __header_size = 16;
+    inline constexpr std::size_t __min_block_size = 32;
+    inline constexpr std::size_t __num_classes = 8;
+    inline constexpr std::size_t __max_block_size = __min_block_size << (__num_classes - 1);
+    inline constexpr std::size_t __max_alignment = __header_size;
+    inline constexpr std::size_t __chunk_size = 64 * 1024;
+
+    struct __thread_cache;
+
+    struct alignas(__header_size) __block_header {
+      __thread_cache* __owner_;
+    };
+
+    // The payload of a free block.
+    struct __free_node {
+      std::atomic<void*> __next_;
+    };
+
+    inline auto __size_class(std::size_t __bytes) noexcept -> std::size_t {
+      const std::size_t __block = __bytes + __header_size;
+      return __block <= __min_block_size
+             ? 0
+             : static_cast<std::size_t>(std::bit_width(__block - 1))
+                 - static_cast<std::size_t>(std::bit_width(__min_block_size - 1));
+    }
+
+    inline auto __header_of(void* __payload) noexcept -> __block_header* {
+      return reinterpret_cast<__block_header*>(static_cast<std::byte*>(__payload) - __header_size);
+    }
+
+    // The per-thread state of the allocator. A cache is owned by at most one thread at a time.
+    // Blocks freed by the owner go straight back to its free lists; blocks freed by any other
+    // thread are pushed onto the cache's lock-free MPSC list and reclaimed in a batch by the owner
+    // when one of its free lists runs dry.
+    //
+    // Caches and their chunks are never returned to the system. When a thread exits, its cache
+    // is handed to the next thread that needs one, together with any blocks still in flight.
+    struct __thread_cache {
+      auto __allocate(std::size_t __class) -> void* {
+        __free_node* __node = __free_[__class];
+        if (__node == nullptr) {
+          __reclaim_remote_frees();
+          __node = __free_[__class];
+        }
+        if (__node != nullptr) {
+          __free_[__class] = static_cast<__free_node*>(
+            __node->__next_.load(std::memory_order_relaxed));
+          return __node;
+        }
+        return __carve(__class);
+      }
+
+      void __deallocate(void* __payload, std::size_t __class) noexcept {
+        auto* __node = ::new (__payload) __free_node{__free_[__class]};
+        __free_[__class] = __node;
+      }
+
+      void __deallocate_remote(void* __payload) noexcept {
+        __remote_frees_.push_back(::new (__payload) __free_node{nullptr});
+      }
+
+      __thread_cache* __next_orphan_ = nullptr;
+
+     private:
+      void __reclaim_remote_frees() noexcept {
+        while (__free_node* __node = __remote_frees_.pop_front()) {
+          // A block freed remotely carries its size class in its header (see __deallocate).
+          const auto __class = reinterpret_cast<std::size_t>(__header_of(__node)->__owner_);
+          __header_of(__node)->__owner_ = this;
+          __deallocate(__node, __class);
+        }
+      }
+
+      auto __carve(std::size_t __class) -> void* {
+        const std::size_t __block_size = __min_block_size << __class;
+        if (static_cast<std::size_t>(__chunk_end_ - __chunk_cur_) < __block_size) {
+          numa_allocator<std::byte> __alloc{__numa_node_};
+          __chunk_cur_ = __alloc.allocate(__chunk_size);
+          __chunk_end_ = __chunk_cur_ + __chunk_size;
+        }
+        auto* __header = ::new (__chunk_cur_) __block_header{this};
+        __chunk_cur_ += __block_size;
+        return reinterpret_cast<std::byte*>(__header) + __header_size;
+      }
+
+      __free_node* __free_[__num_classes]{};
+      stdexec::__intrusive_mpsc_queue<&__free_node::__next_> __remote_frees_;
+      std::byte* __chunk_cur_ = nullptr;
+      std::byte* __chunk_end_ = nullptr;
+      int __numa_node_ = exec::_get_current_numa_node();
+    };
+
+    // Hands out the caches of exited threads before creating new ones.
+    struct __cache_registry {
+      auto __acquire() -> __thread_cache* {
+        {
+          std::lock_guard __lock{__mutex_};
+          if (__thread_cache* __cache = __orphans_) {
+            __orphans_ = std::exchange(__cache->__next_orphan_, nullptr);
+            return __cache;
+          }
+        }
+        return new __thread_cache{};
+      }
+
+      void __release(__thread_cache* __cache) noexcept {
+        std::lock_guard __lock{__mutex_};
+        __cache->__next_orphan_ = std::exchange(__orphans_, __cache);
+      }
+
+      static auto __get() noexcept -> __cache_registry& {
+        // Threads may release their caches after static destruction has started.
+        static stdexec::__indestructible<__cache_registry> __registry{};
+        return __registry.get();
+      }
+
+     private:
+      std::mutex __mutex_;
+      __thread_cache* __orphans_ = nullptr;
+    };
+
+    enum class __thread_state : unsigned char {
+      __uninitialized,
+      __alive,
+      __exited
+    };
+
+    // Trivially destructible, so they remain usable while thread-local objects are destroyed.
+    inline thread_local __thread_cache* __current_cache = nullptr;
+    inline thread_local __thread_state __current_state = __thread_state::__uninitialized;
+
+    struct __thread_handle {
+      __thread_handle()
+        : __cache_(__cache_registry::__get().__acquire()) {
+        __current_cache = __cache_;
+        __current_state = __thread_state::__alive;
+      }
+
+      ~__thread_handle() {
+        __current_cache = nullptr;
+        __current_state = __thread_state::__exited;
+        __cache_registry::__get().__release(__cache_);
+      }
+
+      __thread_cache* __cache_;
+    };
+
+    inline auto __allocate(std::size_t __bytes) -> void* {
+      const std::size_t __class = __size_class(__bytes);
+      if (__current_state == __thread_state::__uninitialized) {
+        thread_local __thread_handle __handle;
+      }
+      if (__current_cache != nullptr) [[likely]] {
+        return __current_cache->__allocate(__class);
+      }
+      // This thread's thread-local objects are being destroyed. Borrow a cache.
+      __cache_registry& __registry = __cache_registry::__get();
+      __thread_cache* __cache = __registry.__acquire();
+      void* __payload = __cache->__allocate(__class);
+      __registry.__release(__cache);
+      return __payload;
+    }
+
+    inline void __deallocate(void* __payload, std::size_t __bytes) noexcept {
+      __block_header* __header = __header_of(__payload);
+      __thread_cache* __owner = __header->__owner_;
+      const std::size_t __class = __size_class(__bytes);
+      if (__owner == __current_cache) {
+        __owner->__deallocate(__payload, __class);
+      } else {
+        // Remember the size class for the owner, which reclaims the block later.
+        __header->__owner_ = reinterpret_cast<__thread_cache*>(__class);
+        __owner->__deallocate_remote(__payload);
+      }
+    }
+  } // namespace __op_alloc
+
+  //! A thread-caching pool allocator for the small, short-lived objects that asynchronous
+  //! operations put on the heap, such as the operation states of `async_scope::spawn` or the
+  //! shared state of `split`. Pass it through the environment:
+  //!
+  //!   scope.spawn(sndr, stdexec::prop{stdexec::get_allocator, exec::op_state_allocator<>{}});
+  //!
+  //! Allocations of up to 4 KiB with an alignment of at most 16 bytes are served from per-thread,
+  //! per-size-class free lists backed by chunks allocated on the thread's NUMA node. Memory freed
+  //! on a thread other than the one that allocated it is handed back to the allocating thread
+  //! without locks. Larger or over-aligned allocations go to `::operator new`.
+  //!
+  //! All instances are interchangeable. Memory is retained by the pool for reuse and is not
+  //! returned to the system.
+  template <class _Ty = std::byte>
+  struct op_state_allocator {
+    using value_type = _Ty;
+
+    op_state_allocator() noexcept = default;
+
+    template <class _Uy>
+    op_state_allocator(const op_state_allocator<_Uy>&) noexcept {
+    }
+
+    [[nodiscard]]
+    auto allocate(std::size_t __n) -> _Ty* {
+      if (__n > std::numeric_limits<std::size_t>::max() / sizeof(_Ty)) {
+        throw std::bad_array_new_length();
+      }
+      const std::size_t __bytes = __n * sizeof(_Ty);
+      if constexpr (alignof(_Ty) > __op_alloc::__max_alignment) {
+        return static_cast<_Ty*>(::operator new(__bytes, std::align_val_t{alignof(_Ty)}));
+      } else {
+        if (__bytes + __op_alloc::__header_size > __op_alloc::__max_block_size) {
+          return static_cast<_Ty*>(::operator new(__bytes));
+        }
+        return static_cast<_Ty*>(__op_alloc::__allocate(__bytes));
+      }
+    }
+
+    void deallocate(_Ty* __ptr, std::size_t __n) noexcept {
+      const std::size_t __bytes = __n * sizeof(_Ty);
+      if constexpr (alignof(_Ty) > __op_alloc::__max_alignment) {
+        ::operator delete(__ptr, __bytes, std::align_val_t{alignof(_Ty)});
+      } else {
+        if (__bytes + __op_alloc::__header_size > __op_alloc::__max_block_size) {
+          ::operator delete(__ptr, __bytes);
+          return;
+        }
+        __op_alloc::__deallocate(__ptr, __bytes);
+      }
+    }
+
+    template <class _Uy>
+    auto operator==(const op_state_allocator<_Uy>&) const noexcept -> bool {
+      return true;
+    }
+  };
+} // namespace exec
@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../stdexec/execution.hpp"
+#include "../stdexec/__detail/__intrusive_mpsc_queue.hpp"
+#include "../stdexec/__detail/__spin_loop_pause.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <optional>
+#include <thread>
+
+namespace exec {
+  namespace __serial {
+    using namespace stdexec;
+
+    struct __task {
+      std::atomic<void*> __next_{nullptr};
+      void (*__execute_)(__task*) noexcept;
+    };
+
+    // The part of a serial executor that does not depend on the underlying scheduler.
+    //
+    // Tasks are pushed onto a lock-free MPSC queue. `__count_` is the number of tasks that have
+    // been pushed but not yet run; the producer that moves it from zero to one schedules a drain
+    // on the underlying scheduler. At most one drain is in flight at any time, so tasks never run
+    // concurrently and run in the order in which they were pushed.
+    class __executor_base {
+     public:
+      using __schedule_drain_fn = void(__executor_base*) noexcept;
+
+      __executor_base(__schedule_drain_fn* __schedule_drain, std::size_t __budget) noexcept
+        : __schedule_drain_(__schedule_drain)
+        , __budget_(__budget == 0 ? 1 : __budget) {
+      }
+
+      void __push(__task* __tsk) noexcept {
+        __queue_.push_back(__tsk);
+        if (__count_.fetch_add(1, std::memory_order_acq_rel) == 0) {
+          __schedule_drain_(this);
+        }
+      }
+
+      // Runs up to `__budget_` tasks, then yields the underlying execution resource by
+      // scheduling another drain if tasks remain.
+      void __drain() noexcept {
+        std::size_t __ran = 0;
+        do {
+          __task* __tsk = __queue_.pop_front();
+          // The task has been counted, but its producer may not have finished linking it yet.
+          while (__tsk == nullptr) {
+            __spin_loop_pause();
+            __tsk = __queue_.pop_front();
+          }
+          __tsk->__execute_(__tsk);
+          ++__ran;
+        } while (__ran < __budget_ && __ran < __count_.load(std::memory_order_acquire));
+
+        // This is the last access to *this unless tasks remain.
+        if (__count_.fetch_sub(__ran, std::memory_order_acq_rel) != __ran) {
+          __schedule_drain_(this);
+        }
+      }
+
+      // Waits for a drain that is still running or scheduled.
+      void __wait_idle() const noexcept {
+        while (__count_.load(std::memory_order_acquire) != 0) {
+          std::this_thread::yield();
+        }
+      }
+
+     private:
+      __intrusive_mpsc_queue<&__task::__next_> __queue_;
+      std::atomic<std::size_t> __count_{0};
+      __schedule_drain_fn* __schedule_drain_;
+      std::size_t __budget_;
+    };
+
+    template <class _ReceiverId>
+    struct __operation {
+      using _Receiver = stdexec::__t<_ReceiverId>;
+
+      struct __t : __task {
+        using __id = __operation;
+
+        __executor_base* __executor_;
+        STDEXEC_ATTRIBUTE((no_unique_address)) _Receiver __rcvr_;
+
+        __t(__executor_base* __executor, _Receiver __rcvr)
+          noexcept(__nothrow_move_constructible<_Receiver>)
+          : __task{{}, &__execute_impl}
+          , __executor_{__executor}
+          , __rcvr_{static_cast<_Receiver&&>(__rcvr)} {
+        }
+
+        static void __execute_impl(__task* __tsk) noexcept {
+          auto& __rcvr = static_cast<__t*>(__tsk)->__rcvr_;
+          if constexpr (unstoppable_token<stop_token_of_t<env_of_t<_Receiver&>>>) {
+            stdexec::set_value(static_cast<_Receiver&&>(__rcvr));
+          } else if (get_stop_token(get_env(__rcvr)).stop_requested()) {
+            stdexec::set_stopped(static_cast<_Receiver&&>(__rcvr));
+          } else {
+            stdexec::set_value(static_cast<_Receiver&&>(__rcvr));
+          }
+        }
+
+        void start() & noexcept {
+          __executor_->__push(this);
+        }
+      };
+    };
+
+    class __scheduler {
+      template <class _Receiver>
+      using __operation_t = stdexec::__t<__operation<__id<__decay_t<_Receiver>>>>;
+
+      struct __schedule_sender {
+        using sender_concept = sender_t;
+        using completion_signatures = stdexec::completion_signatures<set_value_t(), set_stopped_t()>;
+
+        template <receiver_of<completion_signatures> _Receiver>
+        auto connect(_Receiver __rcvr) const noexcept(__nothrow_move_constructible<_Receiver>)
+          -> __operation_t<_Receiver> {
+          return {__executor_, static_cast<_Receiver&&>(__rcvr)};
+        }
+
+        auto query(get_completion_scheduler_t<set_value_t>) const noexcept -> __scheduler {
+          return __scheduler{__executor_};
+        }
+
+        auto get_env() const noexcept -> const __schedule_sender& {
+          return *this;
+        }
+
+        __executor_base* __executor_;
+      };
+
+      __executor_base* __executor_;
+
+     public:
+      explicit __scheduler(__executor_base* __executor) noexcept
+        : __executor_(__executor) {
+      }
+
+      [[nodiscard]]
+      auto schedule() const noexcept -> __schedule_sender {
+        return __schedule_sender{__executor_};
+      }
+
+      auto query(get_forward_progress_guarantee_t) const noexcept -> forward_progress_guarantee {
+        return forward_progress_guarantee::weakly_parallel;
+      }
+
+      auto operator==(const __scheduler&) const noexcept -> bool = default;
+    };
+
+    struct __drain_receiver {
+      using receiver_concept = receiver_t;
+
+      __executor_base* __executor_;
+
+      void set_value() noexcept {
+        __executor_->__drain();
+      }
+
+      [[noreturn]]
+      void set_error(std::exception_ptr) noexcept {
+        std::terminate();
+      }
+
+      // A drain that is cancelled by the underlying scheduler would strand the queued tasks.
+      [[noreturn]]
+      void set_stopped() noexcept {
+        std::terminate();
+      }
+    };
+  } // namespace __serial
+
+  //! Runs the work scheduled on it one item at a time, in FIFO order, on the execution resource
+  //! of an underlying scheduler. Unlike `single_thread_context`, it owns no thread and takes no
+  //! lock: a drain task is scheduled on the underlying scheduler only when the queue goes from
+  //! empty to non-empty, and each drain runs at most `budget` items before it reschedules
+  //! itself to let other work on the underlying resource make progress.
+  //!
+  //! The underlying scheduler's `schedule` operation must complete with `set_value`, and
+  //! connecting to it must not throw.
+  template <stdexec::scheduler _Scheduler>
+  class serial_executor : __serial::__executor_base {
+    using __drain_op_t = stdexec::connect_result_t<
+      stdexec::schedule_result_t<_Scheduler&>,
+      __serial::__drain_receiver>;
+
+    static void __schedule_drain(__serial::__executor_base* __base) noexcept {
+      auto* __self = static_cast<serial_executor*>(__base);
+      // This may destroy the operation state whose completion is running the current drain,
+      // which is fine because nothing touches it after its receiver's completion.
+      stdexec::start(__self->__drain_op_.emplace(stdexec::__emplace_from{[__self] {
+        return stdexec::connect(
+          stdexec::schedule(__self->__sched_), __serial::__drain_receiver{__self});
+      }}));
+    }
+
+    _Scheduler __sched_;
+    std::optional<__drain_op_t> __drain_op_;
+
+   public:
+    static constexpr std::size_t default_budget = 64;
+
+    explicit serial_executor(_Scheduler __sched, std::size_t __budget = default_budget)
+      : __serial::__executor_base(&__schedule_drain, __budget)
+      , __sched_(static_cast<_Scheduler&&>(__sched)) {
+    }
+
+    //! Waits for the work that has been scheduled to finish running.
+    ~serial_executor() {
+      this->__wait_idle();
+    }
+
+    auto get_scheduler() noexcept -> __serial::__scheduler {
+      return __serial::__scheduler{this};
+    }
+  };
+} // namespace exec
@@ -0,0 +1,453 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../stdexec/execution.hpp"
+#include "../stdexec/stop_token.hpp"
+#include "../stdexec/__detail/__allocator.hpp"
+#include "../stdexec/__detail/__intrusive_queue.hpp"
+#include "async_scope.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace exec {
+  /////////////////////////////////////////////////////////////////////////////
+  // sharded_scope
+  namespace __sharded {
+    using namespace stdexec;
+
+    using __scope::__env_t;
+
+    struct alignas(64) __shard {
+      std::atomic<std::ptrdiff_t> __count_{0};
+    };
+
+    struct __waiter : __immovable {
+      void (*__notify_)(__waiter*) noexcept;
+      __waiter* __next_ = nullptr;
+    };
+
+    // Threads are assigned to shards round-robin, in the order in which they first use a scope.
+    inline auto __this_thread_index() noexcept -> std::size_t {
+      static std::atomic<std::size_t> __next_index{0};
+      thread_local const std::size_t __index = __next_index.fetch_add(1, std::memory_order_relaxed);
+      return __index;
+    }
+
+    // The in-flight count of the scope is the sum of the counts of its shards. An operation
+    // increments the shard of the thread that starts it and decrements the same shard when it
+    // completes, so while the scope is open, the hot paths touch only a cache line that is
+    // shared with the operations started on the same thread.
+    //
+    // The sum cannot be observed while the scope is open. Closing the scope folds every shard
+    // into `__central_`: each shard is replaced with the `__folded` marker and its count is
+    // added to `__central_`. Operations that find their shard folded fail to start, or count
+    // down `__central_` if they are completing. `__central_` starts out with a bias that is
+    // larger than any possible count and that the closer removes only after it has folded all
+    // shards, so it can reach zero only when the scope is closed and all operations have
+    // completed. Whoever brings it to zero notifies the `on_empty` waiters.
+    struct __impl {
+      static constexpr std::ptrdiff_t __folded = std::numeric_limits<std::ptrdiff_t>::min();
+      static constexpr std::ptrdiff_t __open_bias = std::numeric_limits<std::ptrdiff_t>::max() / 2;
+
+      explicit __impl(std::size_t __num_shards)
+        : __shards_(new __shard[std::bit_ceil(std::max<std::size_t>(__num_shards, 1))])
+        , __mask_(std::bit_ceil(std::max<std::size_t>(__num_shards, 1)) - 1) {
+      }
+
+      ~__impl() {
+        if (__closed_.load(std::memory_order_relaxed)) {
+          STDEXEC_ASSERT(__central_.load(std::memory_order_relaxed) == 0);
+        } else {
+          [[maybe_unused]]
+          std::ptrdiff_t __sum = 0;
+          for (std::size_t __i = 0; __i <= __mask_; ++__i) {
+            __sum += __shards_[__i].__count_.load(std::memory_order_relaxed);
+          }
+          STDEXEC_ASSERT(__sum == 0);
+        }
+        STDEXEC_ASSERT(__waiters_.empty());
+      }
+
+      // Counts an operation in. Returns the shard to count it out of, or nullptr if the scope
+      // is closed.
+      auto __try_add() noexcept -> __shard* {
+        __shard* __shrd = &__shards_[__this_thread_index() & __mask_];
+        std::ptrdiff_t __count = __shrd->__count_.load(std::memory_order_relaxed);
+        do {
+          if (__count == __folded) {
+            return nullptr;
+          }
+        } while (!__shrd->__count_.compare_exchange_weak(
+          __count, __count + 1, std::memory_order_relaxed));
+        return __shrd;
+      }
+
+      // Counts an operation out. The scope may be destroyed by the time this returns.
+      void __remove(__shard* __shrd) noexcept {
+        std::ptrdiff_t __count = __shrd->__count_.load(std::memory_order_relaxed);
+        while (__count != __folded) {
+          if (__shrd->__count_.compare_exchange_weak(
+                __count, __count - 1, std::memory_order_release, std::memory_order_relaxed)) {
+            return;
+          }
+        }
+        if (__central_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+          __notify_waiters();
+        }
+      }
+
+      // Closes the scope. The scope may be destroyed by the time this returns.
+      void __close() noexcept {
+        if (__closed_.exchange(true, std::memory_order_acq_rel)) {
+          return;
+        }
+        std::ptrdiff_t __sum = 0;
+        for (std::size_t __i = 0; __i <= __mask_; ++__i) {
+          __sum += __shards_[__i].__count_.exchange(__folded, std::memory_order_acq_rel);
+        }
+        if (__central_.fetch_add(__sum - __open_bias, std::memory_order_acq_rel)
+            == __open_bias - __sum) {
+          __notify_waiters();
+        }
+      }
+
+      // Returns false if the scope is already closed and empty, in which case the waiter is
+      // not enqueued.
+      auto __try_wait(__waiter* __wtr) noexcept -> bool {
+        std::unique_lock __guard{__mutex_};
+        if (__empty_) {
+          return false;
+        }
+        __waiters_.push_back(__wtr);
+        return true;
+      }
+
+      void __notify_waiters() noexcept {
+        std::unique_lock __guard{__mutex_};
+        __empty_ = true;
+        auto __local_waiters = std::move(__waiters_);
+        __guard.unlock();
+        // do not access this
+        while (!__local_waiters.empty()) {
+          auto* __next = __local_waiters.pop_front();
+          __next->__notify_(__next);
+          // this must be considered deleted
+        }
+      }
+
+      inplace_stop_source __stop_source_{};
+      std::unique_ptr<__shard[]> __shards_;
+      std::size_t __mask_;
+      std::atomic<std::ptrdiff_t> __central_{__open_bias};
+      std::atomic<bool> __closed_{false};
+      std::mutex __mutex_{};
+      bool __empty_ = false;
+      __intrusive_queue<&__waiter::__next_> __waiters_{};
+    };
+
+    ////////////////////////////////////////////////////////////////////////////
+    // sharded_scope::on_empty implementation
+    template <class _ReceiverId>
+    struct __on_empty_op {
+      using _Receiver = stdexec::__t<_ReceiverId>;
+
+      struct __t : __waiter {
+        using __id = __on_empty_op;
+
+        __t(__impl* __scope, _Receiver __rcvr)
+          : __waiter{{}, &__notify_impl}
+          , __scope_(__scope)
+          , __rcvr_(static_cast<_Receiver&&>(__rcvr)) {
+        }
+
+        void start() & noexcept {
+          if (!__scope_->__try_wait(this)) {
+            stdexec::set_value(static_cast<_Receiver&&>(__rcvr_));
+          }
+        }
+
+       private:
+        static void __notify_impl(__waiter* __self) noexcept {
+          stdexec::set_value(static_cast<_Receiver&&>(static_cast<__t*>(__self)->__rcvr_));
+        }
+
+        __impl* __scope_;
+        STDEXEC_ATTRIBUTE((no_unique_address)) _Receiver __rcvr_;
+      };
+    };
+
+    struct __on_empty_sender {
+      using sender_concept = stdexec::sender_t;
+      using completion_signatures = stdexec::completion_signatures<set_value_t()>;
+
+      template <receiver_of<completion_signatures> _Receiver>
+      [[nodiscard]]
+      auto connect(_Receiver __rcvr) const -> stdexec::__t<__on_empty_op<__id<_Receiver>>> {
+        return {__scope_, static_cast<_Receiver&&>(__rcvr)};
+      }
+
+      __impl* __scope_;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////
+    // sharded_scope::nest implementation
+    template <class _ReceiverId>
+    struct __nest_op_base : __immovable {
+      using _Receiver = stdexec::__t<_ReceiverId>;
+      __impl* __scope_;
+      __shard* __shard_ = nullptr;
+      STDEXEC_ATTRIBUTE((no_unique_address)) _Receiver __rcvr_;
+    };
+
+    template <class _ReceiverId>
+    struct __nest_rcvr {
+      using _Receiver = stdexec::__t<_ReceiverId>;
+
+      struct __t {
+        using __id = __nest_rcvr;
+        using receiver_concept = stdexec::receiver_t;
+        __nest_op_base<_ReceiverId>* __op_;
+
+        template <class... _As>
+          requires __callable<set_value_t, _Receiver, _As...>
+        void set_value(_As&&... __as) noexcept {
+          auto* __scope = __op_->__scope_;
+          auto* __shrd = __op_->__shard_;
+          stdexec::set_value(std::move(__op_->__rcvr_), static_cast<_As&&>(__as)...);
+          // do not access __op_
+          // do not access this
+          __scope->__remove(__shrd);
+        }
+
+        template <class _Error>
+          requires __callable<set_error_t, _Receiver, _Error>
+        void set_error(_Error&& __err) noexcept {
+          auto* __scope = __op_->__scope_;
+          auto* __shrd = __op_->__shard_;
+          stdexec::set_error(std::move(__op_->__rcvr_), static_cast<_Error&&>(__err));
+          // do not access __op_
+          // do not access this
+          __scope->__remove(__shrd);
+        }
+
+        void set_stopped() noexcept
+          requires __callable<set_stopped_t, _Receiver>
+        {
+          auto* __scope = __op_->__scope_;
+          auto* __shrd = __op_->__shard_;
+          stdexec::set_stopped(std::move(__op_->__rcvr_));
+          // do not access __op_
+          // do not access this
+          __scope->__remove(__shrd);
+        }
+
+        auto get_env() const noexcept -> __env_t<env_of_t<_Receiver>> {
+          return make_env(
+            stdexec::get_env(__op_->__rcvr_),
+            stdexec::prop{get_stop_token, __op_->__scope_->__stop_source_.get_token()});
+        }
+      };
+    };
+
+    template <class _ConstrainedId, class _ReceiverId>
+    struct __nest_op {
+      using _Constrained = stdexec::__t<_ConstrainedId>;
+      using _Receiver = stdexec::__t<_ReceiverId>;
+
+      struct __t : __nest_op_base<_ReceiverId> {
+        using __id = __nest_op;
+        using __nest_rcvr_t = stdexec::__t<__nest_rcvr<_ReceiverId>>;
+        STDEXEC_IMMOVABLE_NO_UNIQUE_ADDRESS
+        connect_result_t<_Constrained, __nest_rcvr_t> __op_;
+
+        template <__decays_to<_Constrained> _Sender, __decays_to<_Receiver> _Rcvr>
+        explicit __t(__impl* __scope, _Sender&& __c, _Rcvr&& __rcvr)
+          : __nest_op_base<_ReceiverId>{{}, __scope, nullptr, static_cast<_Rcvr&&>(__rcvr)}
+          , __op_(stdexec::connect(static_cast<_Sender&&>(__c), __nest_rcvr_t{this})) {
+        }
+
+        void start() & noexcept {
+          STDEXEC_ASSERT(this->__scope_);
+          this->__shard_ = this->__scope_->__try_add();
+          if (this->__shard_ == nullptr) {
+            // The scope is closed.
+            stdexec::set_stopped(static_cast<_Receiver&&>(this->__rcvr_));
+            return;
+          }
+          stdexec::start(__op_);
+        }
+      };
+    };
+
+    template <class _ConstrainedId>
+    struct __nest_sender {
+      using _Constrained = stdexec::__t<_ConstrainedId>;
+
+      struct __t {
+        using __id = __nest_sender;
+        using sender_concept = stdexec::sender_t;
+
+        __impl* __scope_;
+        STDEXEC_ATTRIBUTE((no_unique_address)) _Constrained __c_;
+
+        template <class _Receiver>
+        using __nest_operation_t =
+          stdexec::__t<__nest_op<_ConstrainedId, stdexec::__id<_Receiver>>>;
+
+        template <class _Receiver>
+        using __nest_receiver_t = stdexec::__t<__nest_rcvr<stdexec::__id<_Receiver>>>;
+
+        template <__decays_to<__t> _Self, receiver _Receiver>
+          requires sender_to<__copy_cvref_t<_Self, _Constrained>, __nest_receiver_t<_Receiver>>
+                && __callable<set_stopped_t, _Receiver>
+        [[nodiscard]]
+        static auto connect(_Self&& __self, _Receiver __rcvr) -> __nest_operation_t<_Receiver> {
+          return __nest_operation_t<_Receiver>{
+            __self.__scope_, static_cast<_Self&&>(__self).__c_, static_cast<_Receiver&&>(__rcvr)};
+        }
+
+        template <__decays_to<__t> _Self, class _Env>
+        static auto get_completion_signatures(_Self&&, _Env&&) -> __try_make_completion_signatures<
+          __copy_cvref_t<_Self, _Constrained>,
+          __env_t<_Env>,
+          stdexec::completion_signatures<set_stopped_t()>> {
+          return {};
+        }
+      };
+    };
+
+    template <class _Constrained>
+    using __nest_sender_t = stdexec::__t<__nest_sender<__id<__decay_t<_Constrained>>>>;
+
+    ////////////////////////////////////////////////////////////////////////////
+    // sharded_scope::spawn implementation
+    using __scope::__spawn_env_;
+    using __scope::__spawn_env_t;
+    using __scope::__spawn_op_base;
+    using __scope::__spawn_receiver_t;
+
+    template <class _SenderId, class _EnvId>
+    struct __spawn_op {
+      using _Env = stdexec::__t<_EnvId>;
+      using _Sender = stdexec::__t<_SenderId>;
+
+      struct __t : __spawn_op_base<_EnvId> {
+        template <__decays_to<_Sender> _Sndr>
+        __t(_Sndr&& __sndr, _Env __env, const __impl* __scope)
+          : __spawn_op_base<_EnvId>{__env::__join(static_cast<_Env&&>(__env),
+            __spawn_env_{__scope->__stop_source_.get_token()}),
+            [](__spawn_op_base<_EnvId>* __op) noexcept {
+                // The allocator is a copy, so it survives the destruction of __env_.
+                auto __alloc = stdexec::__get_env_allocator(__op->__env_);
+                stdexec::__allocate_delete(__alloc, static_cast<__t*>(__op));
+            }}
+          , __op_(stdexec::connect(static_cast<_Sndr&&>(__sndr), __spawn_receiver_t<_Env>{this})) {
+        }
+
+        void start() & noexcept {
+          stdexec::start(__op_);
+        }
+
+        connect_result_t<_Sender, __spawn_receiver_t<_Env>> __op_;
+      };
+    };
+
+    template <class _Sender, class _Env>
+    using __spawn_operation_t = stdexec::__t<__spawn_op<__id<_Sender>, __id<_Env>>>;
+
+    ////////////////////////////////////////////////////////////////////////////
+    // sharded_scope
+
+    //! An async scope for very high rates of `nest` and `spawn` from many threads.
+    //!
+    //! Unlike `async_scope`, which keeps its count of in-flight operations under a mutex,
+    //! `sharded_scope` splits the count across cache-line-sized shards, one per group of
+    //! threads, and takes no lock on the paths that start and complete operations. The price is
+    //! that emptiness can only be detected once the scope is closed: `on_empty()` completes
+    //! after `close()` or `request_stop()` has been called and every operation nested in the
+    //! scope has completed. Operations that start after the scope has been closed complete
+    //! with `set_stopped` without running.
+    struct sharded_scope : __immovable {
+      //! Creates a scope with `num_shards` shards, rounded up to a power of two. Threads that
+      //! nest work concurrently should use distinct shards, so the default is one shard per
+      //! hardware thread.
+      explicit sharded_scope(std::size_t __num_shards = std::thread::hardware_concurrency())
+        : __impl_(__num_shards) {
+      }
+
+      //! Returns a sender that completes once the scope is closed and empty.
+      [[nodiscard]]
+      auto on_empty() noexcept -> __on_empty_sender {
+        return __on_empty_sender{&__impl_};
+      }
+
+      template <sender _Constrained>
+      using nest_result_t = __nest_sender_t<_Constrained>;
+
+      template <sender _Constrained>
+      [[nodiscard]]
+      auto nest(_Constrained&& __c) -> nest_result_t<_Constrained> {
+        return nest_result_t<_Constrained>{&__impl_, static_cast<_Constrained&&>(__c)};
+      }
+
+      template <__movable_value _Env = empty_env, sender_in<__spawn_env_t<_Env>> _Sender>
+        requires sender_to<nest_result_t<_Sender>, __spawn_receiver_t<_Env>>
+      void spawn(_Sender&& __sndr, _Env __env = {}) {
+        using __op_t = __spawn_operation_t<nest_result_t<_Sender>, _Env>;
+        // start is noexcept so we can assume that the operation will complete
+        // after this, which means we can rely on its self-ownership to ensure
+        // that it is eventually deleted
+        auto __alloc = stdexec::__get_env_allocator(__env);
+        stdexec::start(*stdexec::__allocate_new<__op_t>(
+          __alloc, nest(static_cast<_Sender&&>(__sndr)), static_cast<_Env&&>(__env), &__impl_));
+      }
+
+      //! Prevents operations from starting in the scope from now on. Operations that have
+      //! already started are unaffected.
+      void close() noexcept {
+        __impl_.__close();
+      }
+
+      auto get_stop_source() noexcept -> inplace_stop_source& {
+        return __impl_.__stop_source_;
+      }
+
+      auto get_stop_token() const noexcept -> inplace_stop_token {
+        return __impl_.__stop_source_.get_token();
+      }
+
+      //! Requests the operations in the scope to stop and closes the scope.
+      auto request_stop() noexcept -> bool {
+        const bool __result = __impl_.__stop_source_.request_stop();
+        __impl_.__close();
+        return __result;
+      }
+
+     private:
+      __impl __impl_;
+    };
+  } // namespace __sharded
+
+  using __sharded::sharded_scope;
+} // namespace exec
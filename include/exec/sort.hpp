@@ -0,0 +1,400 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../stdexec/execution.hpp"
+#include "__detail/__xorshift.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace exec {
+  /////////////////////////////////////////////////////////////////////////////
+  // sort(Scheduler, Range, Compare), stable_sort(Scheduler, Range, Compare) and
+  // partition(Scheduler, Range, Predicate)
+  //
+  // Sender factories that rearrange the elements of a random access range in parallel on
+  // `Scheduler`. Each is a fixed chain of `bulk` stages with one agent per block of the input,
+  // so schedulers that customize `bulk` run them in parallel, and `static_thread_pool` fuses
+  // adjacent stages into a single parallel region. Ranges below a cutoff are handled serially.
+  namespace __sort {
+    using namespace stdexec;
+
+    //! Ranges with fewer elements per agent than this are not split any further.
+    inline constexpr std::size_t __serial_cutoff = std::size_t{1} << 14;
+
+    //! The number of samples drawn per bucket to choose the splitters of the sample sort.
+    inline constexpr std::size_t __oversampling = 64;
+
+    //! The bucket of each element is recorded in 16 bits, and there are `2 * blocks - 1`
+    //! buckets.
+    inline constexpr std::size_t __max_blocks = 1u << 15;
+
+    inline auto __num_buckets(std::size_t __num_blocks) noexcept -> std::size_t {
+      return 2 * __num_blocks - 1;
+    }
+
+    inline auto __num_blocks(std::size_t __size) noexcept -> std::size_t {
+      const std::size_t __hw = std::max(std::thread::hardware_concurrency(), 1u);
+      return std::clamp<std::size_t>(__size / __serial_cutoff, 1, std::min(__hw, __max_blocks));
+    }
+
+    //! The half-open range of indices `[begin, end)` of the `__i`-th of `__n` blocks.
+    inline auto __block(std::size_t __size, std::size_t __i, std::size_t __n) noexcept
+      -> std::pair<std::size_t, std::size_t> {
+      return {__size * __i / __n, __size * (__i + 1) / __n};
+    }
+
+    //! Sorts a single range; used for the serial case and for the buckets between splitters.
+    template <bool _Stable>
+    struct __sort_fn {
+      template <class _Iterator, class _Comp>
+      void operator()(_Iterator __first, _Iterator __last, _Comp& __comp) const {
+        if constexpr (_Stable) {
+          std::stable_sort(__first, __last, std::ref(__comp));
+        } else {
+          std::sort(__first, __last, std::ref(__comp));
+        }
+      }
+    };
+
+    //! The state of a parallel sample sort. The range is split into `__num_blocks_` blocks, and
+    //! the elements are distributed to the buckets between and at the `__num_blocks_ - 1`
+    //! splitters:
+    //!
+    //!   1. `__classify` records the bucket of each element and counts them per block.
+    //!   2. `__prefix_sum` computes where each block writes each bucket in the buffer.
+    //!   3. `__scatter` moves the elements of each block to their buckets in the buffer.
+    //!   4. `__sort_bucket` moves each bucket back to the range and sorts it.
+    //!
+    //! Bucket `2 * i + 1` holds the elements equivalent to splitter `i`, so it needs no sorting.
+    //! This keeps a range with few distinct keys from ending up in one bucket that is sorted
+    //! serially. Within a bucket, the elements keep their original order, so sorting the buckets
+    //! with `std::stable_sort` sorts the whole range stably.
+    template <class _Iterator, class _Comp, bool _Stable>
+    struct __sort_state {
+      using __value_t = std::iter_value_t<_Iterator>;
+
+      _Iterator __first_;
+      std::size_t __size_;
+      std::size_t __num_blocks_;
+      STDEXEC_ATTRIBUTE((no_unique_address)) _Comp __comp_;
+      std::vector<std::size_t> __splitters_{};
+      std::vector<std::size_t> __counts_{};
+      std::vector<std::size_t> __buckets_{};
+      std::unique_ptr<std::uint16_t[]> __bucket_of_{};
+      std::unique_ptr<__value_t[]> __buffer_{};
+
+      __sort_state(_Iterator __first, std::size_t __size, std::size_t __num_blocks, _Comp __comp)
+        : __first_(__first)
+        , __size_(__size)
+        , __num_blocks_(__num_blocks)
+        , __comp_(static_cast<_Comp&&>(__comp)) {
+        if (__num_blocks_ == 1) {
+          return;
+        }
+        __choose_splitters();
+        __counts_.resize(__num_blocks_ * __sort::__num_buckets(__num_blocks_));
+        __buckets_.resize(__sort::__num_buckets(__num_blocks_) + 1);
+        __bucket_of_ = std::make_unique_for_overwrite<std::uint16_t[]>(__size_);
+        __buffer_ = std::make_unique_for_overwrite<__value_t[]>(__size_);
+      }
+
+      auto __at(std::size_t __i) const noexcept -> _Iterator {
+        return __first_ + static_cast<std::iter_difference_t<_Iterator>>(__i);
+      }
+
+      auto __less(std::size_t __i, std::size_t __j) -> bool {
+        return std::invoke(__comp_, *__at(__i), *__at(__j));
+      }
+
+      //! Sorts a random sample of the indices and takes every `__oversampling`-th as a splitter.
+      //! The splitters refer to elements of the range, which is not modified until they are
+      //! no longer needed.
+      void __choose_splitters() {
+        xorshift __rng{__size_};
+        std::vector<std::size_t> __sample(__num_blocks_ * __oversampling);
+        for (auto& __i: __sample) {
+          __i = __rng() % __size_;
+        }
+        std::sort(__sample.begin(), __sample.end(), [this](std::size_t __i, std::size_t __j) {
+          return __less(__i, __j);
+        });
+        __splitters_.resize(__num_blocks_ - 1);
+        for (std::size_t __b = 1; __b < __num_blocks_; ++__b) {
+          __splitters_[__b - 1] = __sample[__b * __oversampling];
+        }
+      }
+
+      void __classify(std::size_t __block) {
+        if (__num_blocks_ == 1) {
+          return;
+        }
+        auto [__begin, __end] = __sort::__block(__size_, __block, __num_blocks_);
+        std::size_t* __counts =
+          __counts_.data() + __block * __sort::__num_buckets(__num_blocks_);
+        for (std::size_t __i = __begin; __i < __end; ++__i) {
+          const auto __s = static_cast<std::size_t>(
+            std::upper_bound(
+              __splitters_.begin(),
+              __splitters_.end(),
+              __i,
+              [this](std::size_t __elem, std::size_t __s) { return __less(__elem, __s); })
+            - __splitters_.begin());
+          // The element is not less than splitter `__s - 1`, so it is equivalent to it unless
+          // it is greater.
+          const std::size_t __b =
+            __s != 0 && !__less(__splitters_[__s - 1], __i) ? 2 * __s - 1 : 2 * __s;
+          __bucket_of_[__i] = static_cast<std::uint16_t>(__b);
+          ++__counts[__b];
+        }
+      }
+
+      //! Replaces the counts with the offsets at which each block writes each bucket.
+      void __prefix_sum() noexcept {
+        if (__num_blocks_ == 1) {
+          return;
+        }
+        const std::size_t __num_buckets = __sort::__num_buckets(__num_blocks_);
+        std::size_t __offset = 0;
+        for (std::size_t __b = 0; __b < __num_buckets; ++__b) {
+          __buckets_[__b] = __offset;
+          for (std::size_t __block = 0; __block < __num_blocks_; ++__block) {
+            std::size_t& __count = __counts_[__block * __num_buckets + __b];
+            __offset += std::exchange(__count, __offset);
+          }
+        }
+        __buckets_[__num_buckets] = __offset;
+      }
+
+      void __scatter(std::size_t __block) {
+        if (__num_blocks_ == 1) {
+          return;
+        }
+        auto [__begin, __end] = __sort::__block(__size_, __block, __num_blocks_);
+        std::size_t* __offsets =
+          __counts_.data() + __block * __sort::__num_buckets(__num_blocks_);
+        for (std::size_t __i = __begin; __i < __end; ++__i) {
+          __buffer_[__offsets[__bucket_of_[__i]]++] = std::ranges::iter_move(__at(__i));
+        }
+      }
+
+      void __sort_bucket(std::size_t __b) {
+        if (__num_blocks_ == 1) {
+          __sort_fn<_Stable>()(__first_, __at(__size_), __comp_);
+          return;
+        }
+        const std::size_t __begin = __buckets_[__b];
+        const std::size_t __end = __buckets_[__b + 1];
+        std::move(__buffer_.get() + __begin, __buffer_.get() + __end, __at(__begin));
+        if (__b % 2 == 0) {
+          __sort_fn<_Stable>()(__at(__begin), __at(__end), __comp_);
+        }
+      }
+    };
+
+    template <bool _Stable>
+    struct __sort_t {
+      template <
+        scheduler _Scheduler,
+        std::ranges::random_access_range _Range,
+        class _Comp = std::ranges::less>
+        requires std::ranges::sized_range<_Range> && std::ranges::borrowed_range<_Range>
+              && std::sortable<std::ranges::iterator_t<_Range>, _Comp>
+              && std::default_initializable<std::ranges::range_value_t<_Range>>
+              && __decay_copyable<_Comp>
+      auto operator()(_Scheduler&& __sched, _Range&& __rng, _Comp __comp = {}) const {
+        using __iterator_t = std::ranges::iterator_t<_Range>;
+        using __state_t = __sort_state<__iterator_t, _Comp, _Stable>;
+        const auto __size = static_cast<std::size_t>(std::ranges::size(__rng));
+        const std::size_t __num_blocks = __sort::__num_blocks(__size);
+        return stdexec::schedule(static_cast<_Scheduler&&>(__sched))
+             | stdexec::then(
+                 [__first = std::ranges::begin(__rng), __size, __num_blocks, __comp]() mutable {
+                   return __state_t{__first, __size, __num_blocks, static_cast<_Comp&&>(__comp)};
+                 })
+             | stdexec::bulk(
+                 __num_blocks, [](std::size_t __block, __state_t& __state) {
+                   __state.__classify(__block);
+                 })
+             | stdexec::then([](__state_t&& __state) noexcept {
+                 __state.__prefix_sum();
+                 return static_cast<__state_t&&>(__state);
+               })
+             | stdexec::bulk(
+                 __num_blocks, [](std::size_t __block, __state_t& __state) {
+                   __state.__scatter(__block);
+                 })
+             | stdexec::bulk(
+                 __sort::__num_buckets(__num_blocks), [](std::size_t __b, __state_t& __state) {
+                   __state.__sort_bucket(__b);
+                 })
+             | stdexec::then([](__state_t&&) noexcept { });
+      }
+    };
+
+    //! The state of a parallel partition. Every block counts its elements that satisfy the
+    //! predicate, and then moves them to the front of a buffer and the others to the back, in
+    //! their original order. Finally, every block moves its share of the buffer back.
+    template <class _Iterator, class _Pred>
+    struct __partition_state {
+      using __value_t = std::iter_value_t<_Iterator>;
+
+      _Iterator __first_;
+      std::size_t __size_;
+      std::size_t __num_blocks_;
+      STDEXEC_ATTRIBUTE((no_unique_address)) _Pred __pred_;
+      std::size_t __num_true_{0};
+      std::vector<std::size_t> __true_offsets_{};
+      std::vector<std::size_t> __false_offsets_{};
+      std::unique_ptr<bool[]> __flags_{};
+      std::unique_ptr<__value_t[]> __buffer_{};
+
+      __partition_state(
+        _Iterator __first,
+        std::size_t __size,
+        std::size_t __num_blocks,
+        _Pred __pred)
+        : __first_(__first)
+        , __size_(__size)
+        , __num_blocks_(__num_blocks)
+        , __pred_(static_cast<_Pred&&>(__pred)) {
+        if (__num_blocks_ == 1) {
+          return;
+        }
+        __true_offsets_.resize(__num_blocks_);
+        __false_offsets_.resize(__num_blocks_);
+        __flags_ = std::make_unique_for_overwrite<bool[]>(__size_);
+        __buffer_ = std::make_unique_for_overwrite<__value_t[]>(__size_);
+      }
+
+      auto __at(std::size_t __i) const noexcept -> _Iterator {
+        return __first_ + static_cast<std::iter_difference_t<_Iterator>>(__i);
+      }
+
+      void __classify(std::size_t __block) {
+        if (__num_blocks_ == 1) {
+          auto __last = std::partition(__first_, __at(__size_), std::ref(__pred_));
+          __num_true_ = static_cast<std::size_t>(__last - __first_);
+          return;
+        }
+        auto [__begin, __end] = __sort::__block(__size_, __block, __num_blocks_);
+        std::size_t __count = 0;
+        for (std::size_t __i = __begin; __i < __end; ++__i) {
+          __flags_[__i] = static_cast<bool>(std::invoke(__pred_, *__at(__i)));
+          __count += __flags_[__i];
+        }
+        __true_offsets_[__block] = __count;
+      }
+
+      void __prefix_sum() noexcept {
+        if (__num_blocks_ == 1) {
+          return;
+        }
+        std::size_t __num_true = 0;
+        for (std::size_t __block = 0; __block < __num_blocks_; ++__block) {
+          __num_true += std::exchange(__true_offsets_[__block], __num_true);
+        }
+        __num_true_ = __num_true;
+        for (std::size_t __block = 0; __block < __num_blocks_; ++__block) {
+          auto [__begin, __end] = __sort::__block(__size_, __block, __num_blocks_);
+          __false_offsets_[__block] = __num_true + __begin - __true_offsets_[__block];
+        }
+      }
+
+      void __scatter(std::size_t __block) {
+        if (__num_blocks_ == 1) {
+          return;
+        }
+        auto [__begin, __end] = __sort::__block(__size_, __block, __num_blocks_);
+        std::size_t __t = __true_offsets_[__block];
+        std::size_t __f = __false_offsets_[__block];
+        for (std::size_t __i = __begin; __i < __end; ++__i) {
+          __buffer_[__flags_[__i] ? __t++ : __f++] = std::ranges::iter_move(__at(__i));
+        }
+      }
+
+      void __move_back(std::size_t __block) {
+        if (__num_blocks_ == 1) {
+          return;
+        }
+        auto [__begin, __end] = __sort::__block(__size_, __block, __num_blocks_);
+        std::move(__buffer_.get() + __begin, __buffer_.get() + __end, __at(__begin));
+      }
+    };
+
+    struct partition_t {
+      template <scheduler _Scheduler, std::ranges::random_access_range _Range, class _Pred>
+        requires std::ranges::sized_range<_Range> && std::ranges::borrowed_range<_Range>
+              && std::permutable<std::ranges::iterator_t<_Range>>
+              && std::indirect_unary_predicate<_Pred, std::ranges::iterator_t<_Range>>
+              && std::default_initializable<std::ranges::range_value_t<_Range>>
+              && __decay_copyable<_Pred>
+      auto operator()(_Scheduler&& __sched, _Range&& __rng, _Pred __pred) const {
+        using __iterator_t = std::ranges::iterator_t<_Range>;
+        using __state_t = __partition_state<__iterator_t, _Pred>;
+        const auto __size = static_cast<std::size_t>(std::ranges::size(__rng));
+        const std::size_t __num_blocks = __sort::__num_blocks(__size);
+        return stdexec::schedule(static_cast<_Scheduler&&>(__sched))
+             | stdexec::then(
+                 [__first = std::ranges::begin(__rng), __size, __num_blocks, __pred]() mutable {
+                   return __state_t{__first, __size, __num_blocks, static_cast<_Pred&&>(__pred)};
+                 })
+             | stdexec::bulk(
+                 __num_blocks, [](std::size_t __block, __state_t& __state) {
+                   __state.__classify(__block);
+                 })
+             | stdexec::then([](__state_t&& __state) noexcept {
+                 __state.__prefix_sum();
+                 return static_cast<__state_t&&>(__state);
+               })
+             | stdexec::bulk(
+                 __num_blocks, [](std::size_t __block, __state_t& __state) {
+                   __state.__scatter(__block);
+                 })
+             | stdexec::bulk(
+                 __num_blocks, [](std::size_t __block, __state_t& __state) {
+                   __state.__move_back(__block);
+                 })
+             | stdexec::then([](__state_t&& __state) noexcept {
+                 return __state.__at(__state.__num_true_);
+               });
+      }
+    };
+  } // namespace __sort
+
+  using sort_t = __sort::__sort_t<false>;
+  using stable_sort_t = __sort::__sort_t<true>;
+  using __sort::partition_t;
+
+  //! Sorts a range in parallel. Completes with no values once the range is sorted.
+  inline constexpr sort_t sort{};
+
+  //! Sorts a range in parallel, preserving the order of equivalent elements.
+  inline constexpr stable_sort_t stable_sort{};
+
+  //! Reorders a range in parallel so that the elements that satisfy the predicate precede the
+  //! others. Completes with an iterator to the first element of the second group.
+  inline constexpr partition_t partition{};
+} // namespace exec
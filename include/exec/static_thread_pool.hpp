@@ -22,15 +22,19 @@
 #include "../stdexec/__detail/__intrusive_queue.hpp"
 #include "../stdexec/__detail/__meta.hpp"
 #include "../stdexec/__detail/__manual_lifetime.hpp"
+#include "../stdexec/__detail/__spin_loop_pause.hpp"
 #include "__detail/__atomic_intrusive_queue.hpp"
 #include "__detail/__bwos_lifo_queue.hpp"
 #include "__detail/__xorshift.hpp"
 #include "__detail/__numa.hpp"
 
+#include "bulk_chunked.hpp"
+#include "repeat_n.hpp"
 #include "sequence_senders.hpp"
 #include "sequence/iterate.hpp"
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <condition_variable>
 #include <cstdint>
@@ -38,7 +42,9 @@
 #include <mutex>
 #include <span>
 #include <thread>
+#include <tuple>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace exec {
@@ -233,17 +239,125 @@ namespace exec {
       using bulk_op_state_t =
         __t<bulk_op_state<__id<__decay_t<Sender>>, __id<__decay_t<Receiver>>, Shape, Fun>>;
 
+      // A chain of adjacent `bulk` stages with the same shape type, e.g.
+      // `bulk(n, f) | bulk(n, g)`, is executed as a single parallel region:
+      // the agents are enqueued once and synchronize between the stages.
+      template <class SenderId, std::integral Shape, class... Funs>
+      struct bulk_fused_sender {
+        using Sender = stdexec::__t<SenderId>;
+        struct __t;
+      };
+
+      template <sender Sender, std::integral Shape, class... Funs>
+      using bulk_fused_sender_t = __t<bulk_fused_sender<__id<__decay_t<Sender>>, Shape, Funs...>>;
+
+      template <class Shape, class... Funs>
+      struct bulk_fused_non_throwing {
+        template <class... Args>
+        using __f = __mand<bulk_non_throwing<Funs, Shape, Args...>...>;
+      };
+
+      template <class CvrefSender, class Receiver, class Shape, bool MayThrow, class... Funs>
+      struct bulk_fused_shared_state;
+
+      template <class CvrefSenderId, class ReceiverId, class Shape, bool MayThrow, class... Funs>
+      struct bulk_fused_receiver {
+        using CvrefSender = __cvref_t<CvrefSenderId>;
+        using Receiver = stdexec::__t<ReceiverId>;
+        struct __t;
+      };
+
+      template <class CvrefSender, class Receiver, class Shape, bool MayThrow, class... Funs>
+      using bulk_fused_receiver_t = __t<
+        bulk_fused_receiver<__cvref_id<CvrefSender>, __id<Receiver>, Shape, MayThrow, Funs...>>;
+
+      template <class CvrefSenderId, class ReceiverId, std::integral Shape, class... Funs>
+      struct bulk_fused_op_state {
+        using CvrefSender = stdexec::__cvref_t<CvrefSenderId>;
+        using Receiver = stdexec::__t<ReceiverId>;
+        struct __t;
+      };
+
+      // `exec::repeat_n` over bulk stages keeps the agents resident across the iterations
+      // instead of enqueueing and joining them once per iteration.
+      template <class SenderId, std::integral Shape, class... Funs>
+      struct bulk_repeat_sender {
+        using Sender = stdexec::__t<SenderId>;
+        struct __t;
+      };
+
+      template <sender Sender, std::integral Shape, class... Funs>
+      using bulk_repeat_sender_t = __t<bulk_repeat_sender<__id<__decay_t<Sender>>, Shape, Funs...>>;
+
+      //! A bulk sender of this pool that can absorb a subsequent `bulk` stage.
+      template <class Sender, class Shape, class Fun>
+      static constexpr bool bulk_fusable = //
+        requires(Sender&& sndr, Shape shape, Fun fun) {
+          __decay_t<Sender>::fuse(static_cast<Sender&&>(sndr), shape, static_cast<Fun&&>(fun));
+        };
+
+      //! `bulk` and `exec::bulk_chunked` are both executed by the bulk senders of this pool.
+      template <class Sender>
+      static constexpr bool bulk_expr = //
+        sender_expr_for<Sender, bulk_t> || sender_expr_for<Sender, exec::bulk_chunked_t>;
+
       struct transform_bulk {
         template <class Data, class Sender>
         auto operator()(bulk_t, Data&& data, Sender&& sndr) {
           auto [shape, fun] = static_cast<Data&&>(data);
-          return bulk_sender_t<Sender, decltype(shape), decltype(fun)>{
-            pool_, static_cast<Sender&&>(sndr), shape, std::move(fun)};
+          return transform(static_cast<Sender&&>(sndr), shape, std::move(fun));
+        }
+
+        template <class Data, class Sender>
+        auto operator()(exec::bulk_chunked_t, Data&& data, Sender&& sndr) {
+          auto [shape, fun] = static_cast<Data&&>(data);
+          return transform(
+            static_cast<Sender&&>(sndr),
+            shape,
+            __bulk_chunked::__bulk_fn<decltype(fun)>{std::move(fun)});
+        }
+
+        template <class Sender, class Shape, class Fun>
+        auto transform(Sender&& sndr, Shape shape, Fun fun) {
+          if constexpr (bulk_expr<Sender>) {
+            // With lazy customization the preceding `bulk` has not been transformed yet.
+            // It runs on the same pool, so transform it here to give it a chance to fuse.
+            return make_bulk(
+              __sexpr_apply(static_cast<Sender&&>(sndr), transform_bulk{pool_}),
+              shape,
+              std::move(fun));
+          } else {
+            return make_bulk(static_cast<Sender&&>(sndr), shape, std::move(fun));
+          }
+        }
+
+        template <class Sender, class Shape, class Fun>
+        auto make_bulk(Sender&& sndr, Shape shape, Fun fun) {
+          if constexpr (bulk_fusable<Sender, Shape, Fun>) {
+            return __decay_t<Sender>::fuse(static_cast<Sender&&>(sndr), shape, std::move(fun));
+          } else {
+            return bulk_sender_t<Sender, Shape, Fun>{
+              pool_, static_cast<Sender&&>(sndr), shape, std::move(fun)};
+          }
         }
 
         static_thread_pool_& pool_;
       };
 
+      //! A bulk sender of this pool that can be repeated without re-enqueueing its agents.
+      template <class Sender>
+      static constexpr bool bulk_repeatable = //
+        requires(Sender&& sndr) {
+          __decay_t<Sender>::repeat(static_cast<Sender&&>(sndr), std::size_t{});
+        };
+
+      struct transform_repeat_n {
+        template <class Sender>
+        auto operator()(exec::repeat_n_t, std::size_t count, Sender&& sndr) {
+          return __decay_t<Sender>::repeat(static_cast<Sender&&>(sndr), count);
+        }
+      };
+
 #if STDEXEC_HAS_STD_RANGES()
       struct transform_iterate {
         template <class Range>
@@ -263,7 +377,8 @@ namespace exec {
      public:
       struct domain : stdexec::default_domain {
         // For eager customization
-        template <sender_expr_for<bulk_t> Sender>
+        template <class Sender>
+          requires bulk_expr<Sender>
         auto transform_sender(Sender&& sndr) const noexcept {
           if constexpr (__completes_on<Sender, static_thread_pool_::scheduler>) {
             auto sched = get_completion_scheduler<set_value_t>(get_env(sndr));
@@ -278,7 +393,8 @@ namespace exec {
         }
 
         // transform the generic bulk sender into a parallel thread-pool bulk sender
-        template <sender_expr_for<bulk_t> Sender, class Env>
+        template <class Sender, class Env>
+          requires bulk_expr<Sender>
         auto transform_sender(Sender&& sndr, const Env& env) const noexcept {
           if constexpr (__completes_on<Sender, static_thread_pool_::scheduler>) {
             auto sched = get_completion_scheduler<set_value_t>(get_env(sndr));
@@ -296,6 +412,16 @@ namespace exec {
           }
         }
 
+        // Keep the agents of bulk senders of this pool resident across the iterations of
+        // `repeat_n`. Only a bulk directly on `schedule` of the pool can be repeated that way,
+        // and such a bulk is always transformed eagerly, so there is no lazy customization.
+        template <sender_expr_for<exec::repeat_n_t> Sender>
+          requires bulk_repeatable<__child_of<Sender>>
+                && sender_of<__child_of<Sender>, set_value_t()>
+        auto transform_sender(Sender&& sndr) const noexcept {
+          return __sexpr_apply(static_cast<Sender&&>(sndr), transform_repeat_n{});
+        }
+
 #if STDEXEC_HAS_STD_RANGES()
         template <sender_expr_for<exec::iterate_t> Sender>
         auto transform_sender(Sender&& sndr) const noexcept {
@@ -429,6 +555,13 @@ namespace exec {
         }
       };
 
+     private:
+      //! The sender of `schedule` on this pool. It only moves execution to the pool, so
+      //! `repeat_n` over a bulk stage can run it once instead of once per iteration.
+      template <class Sender>
+      static constexpr bool schedule_sender = __decays_to<Sender, scheduler::_sender>;
+
+     public:
       auto get_scheduler() noexcept -> scheduler {
         return scheduler{*this};
       }
@@ -554,6 +687,7 @@ namespace exec {
         }
 
         auto pop() -> pop_result;
+        auto try_help() -> bool;
         void push_local(task_base* task);
         void push_local(__intrusive_queue<&task_base::next>&& tasks);
 
@@ -617,6 +751,20 @@ namespace exec {
         xorshift rng_{};
       };
 
+      // Lets a sync_wait on a worker thread execute the pool's tasks instead of blocking.
+      struct thread_wait_helper : stdexec::__loop::__wait_helper {
+        explicit thread_wait_helper(thread_state& state) noexcept
+          : stdexec::__loop::__wait_helper{&help}
+          , state_(state) {
+        }
+
+        static auto help(stdexec::__loop::__wait_helper* self) noexcept -> bool {
+          return static_cast<thread_wait_helper*>(self)->state_.try_help();
+        }
+
+        thread_state& state_;
+      };
+
       void run(std::uint32_t index) noexcept;
       void join() noexcept;
 
@@ -707,6 +855,8 @@ namespace exec {
     inline void static_thread_pool_::run(std::uint32_t threadIndex) noexcept {
       numa_.bind_to_node(threadStates_[threadIndex]->numa_node());
       STDEXEC_ASSERT(threadIndex < threadCount_);
+      thread_wait_helper helper{*threadStates_[threadIndex]};
+      stdexec::__loop::__current_wait_helper() = &helper;
       while (true) {
         // Make a blocking call to de-queue a task if we don't already have one.
         auto [task, queueIndex] = threadStates_[threadIndex]->pop();
@@ -989,6 +1139,22 @@ namespace exec {
       return result;
     }
 
+    // Runs one task from the local queue, the remote queues or a victim without ever sleeping.
+    inline auto static_thread_pool_::thread_state::try_help() -> bool {
+      pop_result result = try_pop();
+      for (std::size_t i = 0; !result.task && i < pool_->maxSteals_; ++i) {
+        result = try_steal_near();
+      }
+      for (std::size_t i = 0; !result.task && i < pool_->maxSteals_; ++i) {
+        result = try_steal_any();
+      }
+      if (!result.task) {
+        return false;
+      }
+      result.task->__execute(result.task, result.queueIndex);
+      return true;
+    }
+
     inline auto static_thread_pool_::thread_state::notify() -> bool {
       if (state_.exchange(state::notified, std::memory_order_relaxed) == state::sleeping) {
         {
@@ -1118,6 +1284,33 @@ namespace exec {
         return {};
       }
 
+      //! Fuse a subsequent `bulk` stage with the same shape type into this one.
+      template <__decays_to<__t> Self, std::same_as<Shape> Shape2, class Fun2>
+      static auto fuse(Self&& self, Shape2 shape, Fun2 fun)
+        -> bulk_fused_sender_t<Sender, Shape, Fun, Fun2> {
+        return {
+          self.pool_,
+          static_cast<Self&&>(self).sndr_,
+          {self.shape_, shape},
+          {static_cast<Self&&>(self).fun_, std::move(fun)}
+        };
+      }
+
+      //! Run this bulk `count` times in a row with the same agents. The predecessor runs only
+      //! once, so this is limited to a bulk that directly follows `schedule` on the pool.
+      template <__decays_to<__t> Self>
+        requires schedule_sender<Sender>
+      static auto
+        repeat(Self&& self, std::size_t count) -> bulk_repeat_sender_t<Sender, Shape, Fun> {
+        return {
+          {self.pool_,
+           static_cast<Self&&>(self).sndr_,
+           {self.shape_},
+           {static_cast<Self&&>(self).fun_}},
+          count
+        };
+      }
+
       auto get_env() const noexcept -> env_of_t<const Sender&> {
         return stdexec::get_env(sndr_);
       }
@@ -1142,9 +1335,7 @@ namespace exec {
               // In the case that the shape is much larger than the total number of threads,
               // then each call to computation will call the function many times.
               auto [begin, end] = even_share(sh_state.shape_, tid, total_threads);
-              for (Shape i = begin; i < end; ++i) {
-                sh_state.fun_(i, args...);
-              }
+              __bulk_chunked::__invoke_chunk(sh_state.fun_, begin, end, args...);
             };
 
             auto completion = [&](auto&... args) {
@@ -1324,6 +1515,433 @@ namespace exec {
       }
     };
 
+    //////////////////////////////////////////////////////////////////////////////////////////////////
+    // What follows is the implementation for fused bulk stages on static_thread_pool_.
+    template <class SenderId, std::integral Shape, class... Funs>
+    struct static_thread_pool_::bulk_fused_sender<SenderId, Shape, Funs...>::__t {
+      using __id = bulk_fused_sender;
+      using sender_concept = sender_t;
+
+      static_thread_pool_& pool_;
+      Sender sndr_;
+      std::array<Shape, sizeof...(Funs)> shapes_;
+      std::tuple<Funs...> funs_;
+
+      template <class Sender, class... Env>
+      using with_error_invoke_t = //
+        __if_c<
+          __v<__value_types_t<
+            __completion_signatures_of_t<Sender, Env...>,
+            bulk_fused_non_throwing<Shape, Funs...>,
+            __q<__mand>>>,
+          completion_signatures<>,
+          __eptr_completion>;
+
+      template <class... Tys>
+      using set_value_t = completion_signatures<set_value_t(stdexec::__decay_t<Tys>...)>;
+
+      template <class Self, class... Env>
+      using __completions_t = //
+        stdexec::transform_completion_signatures<
+          __completion_signatures_of_t<__copy_cvref_t<Self, Sender>, Env...>,
+          with_error_invoke_t<__copy_cvref_t<Self, Sender>, Env...>,
+          set_value_t>;
+
+      template <class Self, class Receiver>
+      using bulk_op_state_t = //
+        stdexec::__t<
+          bulk_fused_op_state<__cvref_id<Self, Sender>, stdexec::__id<Receiver>, Shape, Funs...>>;
+
+      template <__decays_to<__t> Self, receiver Receiver>
+        requires receiver_of<Receiver, __completions_t<Self, env_of_t<Receiver>>>
+      static auto connect(Self&& self, Receiver rcvr) //
+        noexcept(__nothrow_constructible_from<
+                 bulk_op_state_t<Self, Receiver>,
+                 static_thread_pool_&,
+                 std::array<Shape, sizeof...(Funs)>,
+                 std::tuple<Funs...>,
+                 Sender,
+                 Receiver,
+                 std::size_t>) -> bulk_op_state_t<Self, Receiver> {
+        return bulk_op_state_t<Self, Receiver>{
+          self.pool_,
+          self.shapes_,
+          static_cast<Self&&>(self).funs_,
+          static_cast<Self&&>(self).sndr_,
+          static_cast<Receiver&&>(rcvr),
+          1};
+      }
+
+      template <__decays_to<__t> Self, class... Env>
+      static auto get_completion_signatures(Self&&, Env&&...) -> __completions_t<Self, Env...> {
+        return {};
+      }
+
+      //! Append a subsequent `bulk` stage with the same shape type.
+      template <__decays_to<__t> Self, std::same_as<Shape> Shape2, class Fun2>
+      static auto fuse(Self&& self, Shape2 shape, Fun2 fun)
+        -> bulk_fused_sender_t<Sender, Shape, Funs..., Fun2> {
+        return {
+          self.pool_,
+          static_cast<Self&&>(self).sndr_,
+          std::apply([&](auto... shapes) { return std::array{shapes..., shape}; }, self.shapes_),
+          std::tuple_cat(static_cast<Self&&>(self).funs_, std::tuple<Fun2>{std::move(fun)})};
+      }
+
+      //! Run all the stages `count` times in a row with the same agents. The predecessor runs
+      //! only once, so this is limited to stages that directly follow `schedule` on the pool.
+      template <__decays_to<__t> Self>
+        requires schedule_sender<Sender>
+      static auto
+        repeat(Self&& self, std::size_t count) -> bulk_repeat_sender_t<Sender, Shape, Funs...> {
+        return {static_cast<Self&&>(self), count};
+      }
+
+      auto get_env() const noexcept -> env_of_t<const Sender&> {
+        return stdexec::get_env(sndr_);
+      }
+    };
+
+    //! The shared state of fused `stdexec::bulk` stages.
+    //! The stages are run `iterations_` times; each run of a stage is a phase. Every phase is
+    //! split into one slice per agent. An agent first runs its own slice, so that it touches the
+    //! same data as in the previous phase, and then helps with the slices of the agents that have
+    //! not started yet. It then waits until all slices of the phase are done before moving on to
+    //! the next phase. Since an agent only ever waits for slices that are being executed, the
+    //! phases cannot deadlock even if some agents are never scheduled.
+    template <class CvrefSender, class Receiver, class Shape, bool MayThrow, class... Funs>
+    struct static_thread_pool_::bulk_fused_shared_state {
+      static constexpr std::size_t num_stages = sizeof...(Funs);
+
+      //! Stop requests are only honored between iterations, and only if the predecessor can
+      //! complete with `set_stopped` as well.
+      static constexpr bool may_stop =
+        !unstoppable_token<stop_token_of_t<env_of_t<Receiver>>>
+        && __sends<set_stopped_t, CvrefSender, env_of_t<Receiver>>;
+
+      struct bulk_task : task_base {
+        bulk_fused_shared_state* sh_state_;
+
+        bulk_task(bulk_fused_shared_state* sh_state)
+          : sh_state_(sh_state) {
+          this->__execute = [](task_base* t, const std::uint32_t /* tid */) noexcept {
+            auto* self = static_cast<bulk_task*>(t);
+            auto& sh_state = *self->sh_state_;
+            auto total_threads = sh_state.num_agents_required();
+            auto agent = static_cast<std::uint32_t>(self - sh_state.tasks_.data());
+
+            sh_state.apply([&](auto&... args) {
+              for (std::size_t it = 0; it < sh_state.iterations_; ++it) {
+                if (it != 0 && sh_state.stop_requested()) {
+                  break;
+                }
+                [&]<std::size_t... Stages>(std::index_sequence<Stages...>) {
+                  (sh_state.run_phase(
+                     it * num_stages + Stages,
+                     agent,
+                     std::get<Stages>(sh_state.funs_),
+                     sh_state.shapes_[Stages],
+                     args...),
+                   ...);
+                }(std::make_index_sequence<num_stages>());
+              }
+            });
+
+            const bool is_last_thread = sh_state.finished_threads_.fetch_add(1)
+                                     == (total_threads - 1);
+
+            if (is_last_thread) {
+              if constexpr (MayThrow) {
+                if (sh_state.exception_) {
+                  stdexec::set_error(
+                    static_cast<Receiver&&>(sh_state.rcvr_), std::move(sh_state.exception_));
+                  return;
+                }
+              }
+              if constexpr (may_stop) {
+                if (sh_state.stopped_.load(std::memory_order_relaxed)) {
+                  stdexec::set_stopped(static_cast<Receiver&&>(sh_state.rcvr_));
+                  return;
+                }
+              }
+              sh_state.apply([&](auto&... args) {
+                stdexec::set_value(static_cast<Receiver&&>(sh_state.rcvr_), std::move(args)...);
+              });
+            }
+          };
+        }
+      };
+
+      using variant_t = //
+        __value_types_of_t<
+          CvrefSender,
+          env_of_t<Receiver>,
+          __q<__decayed_std_tuple>,
+          __q<__nullable_std_variant>>;
+
+      variant_t data_;
+      static_thread_pool_& pool_;
+      Receiver rcvr_;
+      std::array<Shape, num_stages> shapes_;
+      std::tuple<Funs...> funs_;
+      std::size_t iterations_;
+
+      std::atomic<std::uint32_t> finished_threads_{0};
+      std::atomic<bool> has_exception_{false};
+      std::atomic<bool> stopped_{false};
+      std::exception_ptr exception_;
+      //! Slice `i` has been claimed for all the phases before `claimed_phases_[i]`.
+      std::vector<std::atomic<std::size_t>> claimed_phases_;
+      //! The number of slices finished over all phases.
+      std::atomic<std::size_t> finished_slices_{0};
+      std::vector<bulk_task> tasks_;
+
+      //! The number of agents required is the minimum of the largest stage shape and the
+      //! available parallelism.
+      [[nodiscard]]
+      auto num_agents_required() const -> std::uint32_t {
+        return static_cast<std::uint32_t>(std::min(
+          *std::max_element(shapes_.begin(), shapes_.end()),
+          static_cast<Shape>(pool_.available_parallelism())));
+      }
+
+      auto stop_requested() noexcept -> bool {
+        if constexpr (may_stop) {
+          if (stopped_.load(std::memory_order_relaxed)) {
+            return true;
+          }
+          if (get_stop_token(stdexec::get_env(rcvr_)).stop_requested()) {
+            stopped_.store(true, std::memory_order_relaxed);
+            return true;
+          }
+        }
+        return false;
+      }
+
+      template <class Fun, class... Args>
+      void run_slice(std::uint32_t slice, Fun& fun, Shape shape, Args&... args) noexcept {
+        auto [begin, end] = even_share(shape, slice, num_agents_required());
+        if constexpr (MayThrow) {
+          // Once a stage has thrown, the remaining work is skipped.
+          if (has_exception_.load(std::memory_order_relaxed)) {
+            return;
+          }
+          try {
+            __bulk_chunked::__invoke_chunk(fun, begin, end, args...);
+          } catch (...) {
+            if (!has_exception_.exchange(true, std::memory_order_relaxed)) {
+              exception_ = std::current_exception();
+            }
+          }
+        } else {
+          __bulk_chunked::__invoke_chunk(fun, begin, end, args...);
+        }
+      }
+
+      template <class Fun, class... Args>
+      void run_phase(
+        std::size_t phase,
+        std::uint32_t agent,
+        Fun& fun,
+        Shape shape,
+        Args&... args) noexcept {
+        const std::uint32_t total_threads = num_agents_required();
+        for (std::uint32_t i = 0; i < total_threads; ++i) {
+          const std::uint32_t slice = (agent + i) % total_threads;
+          // All slices have been claimed up to this phase once the previous phase is complete.
+          // Agents that fall behind fail to claim and catch up.
+          std::size_t expected = phase;
+          if (claimed_phases_[slice].compare_exchange_strong(
+                expected, phase + 1, std::memory_order_relaxed)) {
+            run_slice(slice, fun, shape, args...);
+            finished_slices_.fetch_add(1, std::memory_order_release);
+          }
+        }
+
+        // The slices that are still pending are run by other agents; wait for them.
+        const std::size_t target = (phase + 1) * total_threads;
+        for (std::uint32_t spin = 0; finished_slices_.load(std::memory_order_acquire) < target;
+             ++spin) {
+          if (spin < 64) {
+            __spin_loop_pause();
+          } else {
+            std::this_thread::yield();
+          }
+        }
+      }
+
+      template <class F>
+      void apply(F f) {
+        std::visit(
+          [&](auto& tupl) -> void {
+            if constexpr (same_as<__decay_t<decltype(tupl)>, std::monostate>) {
+              std::terminate();
+            } else {
+              std::apply([&](auto&... args) -> void { f(args...); }, tupl);
+            }
+          },
+          data_);
+      }
+
+      //! Construct from a pool, receiver, shapes, functions and the number of iterations.
+      //! Allocates O(min(max(shapes), available_parallelism())) memory.
+      bulk_fused_shared_state(
+        static_thread_pool_& pool,
+        Receiver rcvr,
+        std::array<Shape, num_stages> shapes,
+        std::tuple<Funs...> funs,
+        std::size_t iterations)
+        : pool_{pool}
+        , rcvr_{static_cast<Receiver&&>(rcvr)}
+        , shapes_{shapes}
+        , funs_{std::move(funs)}
+        , iterations_{iterations}
+        , claimed_phases_(num_agents_required())
+        , tasks_{num_agents_required(), {this}} {
+      }
+    };
+
+    template <class CvrefSenderId, class ReceiverId, class Shape, bool MayThrow, class... Funs>
+    struct static_thread_pool_::bulk_fused_receiver<
+      CvrefSenderId,
+      ReceiverId,
+      Shape,
+      MayThrow,
+      Funs...>::__t {
+      using __id = bulk_fused_receiver;
+      using receiver_concept = receiver_t;
+
+      using shared_state = bulk_fused_shared_state<CvrefSender, Receiver, Shape, MayThrow, Funs...>;
+
+      shared_state& shared_state_;
+
+      template <class... As>
+      void set_value(As&&... as) noexcept {
+        using tuple_t = __decayed_std_tuple<As...>;
+
+        shared_state& state = shared_state_;
+
+        if constexpr (MayThrow) {
+          try {
+            state.data_.template emplace<tuple_t>(static_cast<As&&>(as)...);
+          } catch (...) {
+            stdexec::set_error(std::move(state.rcvr_), std::current_exception());
+            return;
+          }
+        } else {
+          state.data_.template emplace<tuple_t>(static_cast<As&&>(as)...);
+        }
+
+        if (state.num_agents_required() && state.iterations_) {
+          state.pool_.bulk_enqueue(state.tasks_.data(), state.num_agents_required());
+        } else {
+          state.apply([&](auto&... args) {
+            stdexec::set_value(std::move(state.rcvr_), std::move(args)...);
+          });
+        }
+      }
+
+      template <class Error>
+      void set_error(Error&& error) noexcept {
+        shared_state& state = shared_state_;
+        stdexec::set_error(static_cast<Receiver&&>(state.rcvr_), static_cast<Error&&>(error));
+      }
+
+      void set_stopped() noexcept {
+        shared_state& state = shared_state_;
+        stdexec::set_stopped(static_cast<Receiver&&>(state.rcvr_));
+      }
+
+      auto get_env() const noexcept -> env_of_t<Receiver> {
+        return stdexec::get_env(shared_state_.rcvr_);
+      }
+    };
+
+    template <class CvrefSenderId, class ReceiverId, std::integral Shape, class... Funs>
+    struct static_thread_pool_::
+      bulk_fused_op_state<CvrefSenderId, ReceiverId, Shape, Funs...>::__t {
+      using __id = bulk_fused_op_state;
+
+      static constexpr bool may_throw = //
+        !__v<__value_types_of_t<
+          CvrefSender,
+          env_of_t<Receiver>,
+          bulk_fused_non_throwing<Shape, Funs...>,
+          __q<__mand>>>;
+
+      using bulk_rcvr = bulk_fused_receiver_t<CvrefSender, Receiver, Shape, may_throw, Funs...>;
+      using shared_state =
+        bulk_fused_shared_state<CvrefSender, Receiver, Shape, may_throw, Funs...>;
+      using inner_op_state = connect_result_t<CvrefSender, bulk_rcvr>;
+
+      shared_state shared_state_;
+
+      inner_op_state inner_op_;
+
+      void start() & noexcept {
+        // Like `exec::repeat_n`, zero iterations do not start the predecessor at all. Only
+        // `repeat` passes a count other than one, and its predecessor sends no values.
+        if constexpr (sender_of<CvrefSender, set_value_t(), env_of_t<Receiver>>) {
+          if (shared_state_.iterations_ == 0) {
+            stdexec::set_value(static_cast<Receiver&&>(shared_state_.rcvr_));
+            return;
+          }
+        }
+        stdexec::start(inner_op_);
+      }
+
+      __t(
+        static_thread_pool_& pool,
+        std::array<Shape, sizeof...(Funs)> shapes,
+        std::tuple<Funs...> funs,
+        CvrefSender&& sndr,
+        Receiver rcvr,
+        std::size_t iterations)
+        : shared_state_(pool, static_cast<Receiver&&>(rcvr), shapes, std::move(funs), iterations)
+        , inner_op_{stdexec::connect(static_cast<CvrefSender&&>(sndr), bulk_rcvr{shared_state_})} {
+      }
+    };
+
+    template <class SenderId, std::integral Shape, class... Funs>
+    struct static_thread_pool_::bulk_repeat_sender<SenderId, Shape, Funs...>::__t {
+      using __id = bulk_repeat_sender;
+      using sender_concept = sender_t;
+      using fused_sender_t = bulk_fused_sender_t<Sender, Shape, Funs...>;
+
+      fused_sender_t sndr_;
+      std::size_t count_;
+
+      template <class Self, class Receiver>
+      using bulk_op_state_t = //
+        stdexec::__t<
+          bulk_fused_op_state<__cvref_id<Self, Sender>, stdexec::__id<Receiver>, Shape, Funs...>>;
+
+      template <class Self, class... Env>
+      using __completions_t =
+        __completion_signatures_of_t<__copy_cvref_t<Self, fused_sender_t>, Env...>;
+
+      template <__decays_to<__t> Self, receiver Receiver>
+        requires receiver_of<Receiver, __completions_t<Self, env_of_t<Receiver>>>
+      static auto connect(Self&& self, Receiver rcvr) -> bulk_op_state_t<Self, Receiver> {
+        return bulk_op_state_t<Self, Receiver>{
+          self.sndr_.pool_,
+          self.sndr_.shapes_,
+          static_cast<Self&&>(self).sndr_.funs_,
+          static_cast<Self&&>(self).sndr_.sndr_,
+          static_cast<Receiver&&>(rcvr),
+          self.count_};
+      }
+
+      template <__decays_to<__t> Self, class... Env>
+      static auto get_completion_signatures(Self&&, Env&&...) -> __completions_t<Self, Env...> {
+        return {};
+      }
+
+      auto get_env() const noexcept -> env_of_t<const Sender&> {
+        return stdexec::get_env(sndr_.sndr_);
+      }
+    };
+
 #if STDEXEC_HAS_STD_RANGES()
     namespace schedule_all_ {
       template <class Rcvr>
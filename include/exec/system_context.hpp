@@ -16,14 +16,27 @@
 #pragma once
 
 #include "stdexec/execution.hpp"
+#include "bulk_chunked.hpp"
+#include "timed_scheduler.hpp"
 #include "__detail/__system_context_replaceability_api.hpp"
 
+#include <chrono>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+
 #ifndef STDEXEC_SYSTEM_CONTEXT_SCHEDULE_OP_SIZE
 #  define STDEXEC_SYSTEM_CONTEXT_SCHEDULE_OP_SIZE 72
 #endif
 #ifndef STDEXEC_SYSTEM_CONTEXT_SCHEDULE_OP_ALIGN
 #  define STDEXEC_SYSTEM_CONTEXT_SCHEDULE_OP_ALIGN 8
 #endif
+#ifndef STDEXEC_SYSTEM_CONTEXT_TIMED_SCHEDULE_OP_SIZE
+#  define STDEXEC_SYSTEM_CONTEXT_TIMED_SCHEDULE_OP_SIZE 160
+#endif
+#ifndef STDEXEC_SYSTEM_CONTEXT_TIMED_SCHEDULE_OP_ALIGN
+#  define STDEXEC_SYSTEM_CONTEXT_TIMED_SCHEDULE_OP_ALIGN 8
+#endif
 #ifndef STDEXEC_SYSTEM_CONTEXT_BULK_SCHEDULE_OP_SIZE
 #  define STDEXEC_SYSTEM_CONTEXT_BULK_SCHEDULE_OP_SIZE 152
 #endif
@@ -82,6 +95,11 @@ namespace exec {
     /// when all chunks complete.
     template <stdexec::sender_expr_for<stdexec::bulk_t> _Sender, class _Env>
     auto transform_sender(_Sender&& __sndr, const _Env& __env) const noexcept;
+
+    /// Schedules new chunked bulk work, splitting `[0, __shape)` in one chunk per item of the
+    /// bulk work, and calling `__fun` with the range of each chunk.
+    template <stdexec::sender_expr_for<bulk_chunked_t> _Sender, class _Env>
+    auto transform_sender(_Sender&& __sndr, const _Env& __env) const noexcept;
   };
 
   namespace __detail {
@@ -216,6 +234,163 @@ namespace exec {
     system_context_replaceability::system_scheduler* __scheduler_;
   };
 
+  namespace __detail {
+    /// Returns the version 3 interface of the backend `__impl`, or null if it does not implement
+    /// it.
+    inline auto __timed_interface_of(system_context_replaceability::system_scheduler* __impl)
+      -> system_context_replaceability::system_scheduler_v3* {
+      auto* __v3 = system_context_replaceability::query_system_context<
+        system_context_replaceability::system_scheduler_v3>();
+      using __v1_t = system_context_replaceability::system_scheduler;
+      if (__v3 != nullptr && static_cast<__v1_t*>(__v3) == __impl) {
+        return __v3;
+      }
+      return nullptr;
+    }
+
+    /// Allows a frontend receiver of type `_Rcvr` to be passed to the backend for a timed
+    /// operation, together with a stop token that follows the one of `_Rcvr`.
+    template <class _Rcvr>
+    struct __timer_receiver_adapter : system_context_replaceability::timer_receiver {
+      struct __on_stop_request {
+        stdexec::inplace_stop_source& __stop_source_;
+
+        void operator()() const noexcept {
+          __stop_source_.request_stop();
+        }
+      };
+
+      using __on_stop_t = stdexec::stop_callback_for_t<
+        stdexec::stop_token_of_t<stdexec::env_of_t<_Rcvr>>,
+        __on_stop_request>;
+
+      explicit __timer_receiver_adapter(_Rcvr&& __rcvr)
+        : __rcvr_{std::forward<_Rcvr>(__rcvr)} {
+      }
+
+      /// Starts following stop requests on the frontend receiver.
+      void __start() noexcept {
+        __on_stop_.emplace(
+          stdexec::get_stop_token(stdexec::get_env(__rcvr_)),
+          __on_stop_request{__stop_source_});
+      }
+
+      void set_value() noexcept override {
+        __on_stop_.reset();
+        stdexec::set_value(std::forward<_Rcvr>(__rcvr_));
+      }
+
+      void set_error(std::exception_ptr __ex) noexcept override {
+        __on_stop_.reset();
+        stdexec::set_error(std::forward<_Rcvr>(__rcvr_), std::move(__ex));
+      }
+
+      void set_stopped() noexcept override {
+        __on_stop_.reset();
+        stdexec::set_stopped(std::forward<_Rcvr>(__rcvr_));
+      }
+
+      stdexec::inplace_stop_token get_stop_token() const noexcept override {
+        return __stop_source_.get_token();
+      }
+
+      [[no_unique_address]]
+      _Rcvr __rcvr_;
+      stdexec::inplace_stop_source __stop_source_{};
+      std::optional<__on_stop_t> __on_stop_{};
+    };
+
+    /// The operation state used to schedule work on the system context at a point in time, or
+    /// once a duration has elapsed.
+    template <class _Time, class _Rcvr>
+    struct __system_timed_op {
+      /// Constructs `this` from `__rcvr`, `__scheduler_impl` and `__time`.
+      __system_timed_op(
+        _Rcvr&& __rcvr,
+        system_context_replaceability::system_scheduler* __scheduler_impl,
+        _Time __time)
+        : __rcvr_{std::forward<_Rcvr>(__rcvr)}
+        , __scheduler_impl_{__scheduler_impl}
+        , __time_{__time} {
+      }
+
+      __system_timed_op(const __system_timed_op&) = delete;
+      __system_timed_op(__system_timed_op&&) = delete;
+      __system_timed_op& operator=(const __system_timed_op&) = delete;
+      __system_timed_op& operator=(__system_timed_op&&) = delete;
+
+      /// Starts the work stored in `this`.
+      void start() & noexcept {
+        auto* __timed_impl = __detail::__timed_interface_of(__scheduler_impl_);
+        if (__timed_impl == nullptr) {
+          stdexec::set_error(
+            std::forward<_Rcvr>(__rcvr_.__rcvr_),
+            std::make_exception_ptr(
+              std::runtime_error{"The system context backend does not support timers"}));
+          return;
+        }
+        __rcvr_.__start();
+        if constexpr (std::same_as<_Time, std::chrono::steady_clock::time_point>) {
+          __timed_impl->schedule_at(__time_, __preallocated_.__as_storage(), &__rcvr_);
+        } else {
+          __timed_impl->schedule_after(__time_, __preallocated_.__as_storage(), &__rcvr_);
+        }
+      }
+
+      /// Object that receives completion from the work described by the sender.
+      __timer_receiver_adapter<_Rcvr> __rcvr_;
+      /// The underlying implementation of the scheduler we are using.
+      system_context_replaceability::system_scheduler* __scheduler_impl_;
+      /// When to run the work.
+      _Time __time_;
+
+      /// Preallocated space for storing the operation state on the implementation size.
+      __aligned_storage<
+        STDEXEC_SYSTEM_CONTEXT_TIMED_SCHEDULE_OP_SIZE,
+        STDEXEC_SYSTEM_CONTEXT_TIMED_SCHEDULE_OP_ALIGN>
+        __preallocated_;
+    };
+  } // namespace __detail
+
+  /// The sender used to schedule new work in the system context at a point in time, or once a
+  /// duration has elapsed. `_Time` is either a `steady_clock::time_point` or a
+  /// `steady_clock::duration`.
+  template <class _Time>
+  class system_timed_sender {
+   public:
+    /// Marks this type as being a sender; not to spec.
+    using sender_concept = stdexec::sender_t;
+    /// Declares the completion signals sent by `this`.
+    using completion_signatures = stdexec::completion_signatures<
+      stdexec::set_value_t(),
+      stdexec::set_stopped_t(),
+      stdexec::set_error_t(std::exception_ptr)>;
+
+    /// Implementation detail. Constructs the sender to wrap `__impl`.
+    system_timed_sender(system_context_replaceability::system_scheduler* __impl, _Time __time)
+      : __scheduler_{__impl}
+      , __time_{__time} {
+    }
+
+    /// Gets the environment of this sender.
+    auto get_env() const noexcept -> __detail::__system_scheduler_env {
+      return {__scheduler_};
+    }
+
+    /// Connects `__self` to `__rcvr`, returning the operation state containing the work to be done.
+    template <stdexec::receiver _Rcvr>
+    auto connect(_Rcvr __rcvr) && noexcept(stdexec::__nothrow_move_constructible<_Rcvr>) //
+      -> __detail::__system_timed_op<_Time, _Rcvr> {
+      return {std::move(__rcvr), __scheduler_, __time_};
+    }
+
+   private:
+    /// The underlying implementation of the system scheduler.
+    system_context_replaceability::system_scheduler* __scheduler_;
+    /// When to run the work.
+    _Time __time_;
+  };
+
   /// A scheduler that can add work to the system context.
   class system_scheduler {
    public:
@@ -243,6 +418,30 @@ namespace exec {
       return {__impl_};
     }
 
+    /// Returns the current time of the clock that timed work is scheduled on.
+    friend auto tag_invoke(exec::now_t, const system_scheduler&) noexcept
+      -> std::chrono::steady_clock::time_point {
+      return std::chrono::steady_clock::now();
+    }
+
+    /// Schedules new work once `__duration` has elapsed.
+    friend auto tag_invoke(
+      exec::schedule_after_t,
+      const system_scheduler& __self,
+      std::chrono::steady_clock::duration __duration) noexcept
+      -> system_timed_sender<std::chrono::steady_clock::duration> {
+      return {__self.__impl_, __duration};
+    }
+
+    /// Schedules new work at `__time_point`.
+    friend auto tag_invoke(
+      exec::schedule_at_t,
+      const system_scheduler& __self,
+      std::chrono::steady_clock::time_point __time_point) noexcept
+      -> system_timed_sender<std::chrono::steady_clock::time_point> {
+      return {__self.__impl_, __time_point};
+    }
+
    private:
     template <stdexec::sender, std::integral, class>
     friend class system_bulk_sender;
@@ -265,7 +464,7 @@ namespace exec {
     /// This represents the base class that abstracts the storage of the values sent by the previous sender.
     /// Derived class will properly implement the receiver methods.
     template <class _Previous>
-    struct __forward_args_receiver : system_context_replaceability::bulk_item_receiver {
+    struct __forward_args_receiver : system_context_replaceability::bulk_chunk_receiver {
       using __storage_t = __detail::__sender_data_t<_Previous>;
 
       /// Storage for the arguments received from the previous sender.
@@ -316,8 +515,35 @@ namespace exec {
           [&](auto&&... __args) { __state->__fun_(__index, __args...); },
           *reinterpret_cast<std::tuple<_As...>*>(__base_t::__arguments_data_));
       }
+
+      /// Calls the bulk functor for each index in `[__begin, __end)`, passing the values from the
+      /// previous sender. The loop is inlined here, rather than making a call across the backend
+      /// interface for each index.
+      void start(uint32_t __begin, uint32_t __end) noexcept override {
+        auto __state = reinterpret_cast<_BulkState*>(this);
+        std::apply(
+          [&](auto&&... __args) {
+            for (uint32_t __index = __begin; __index < __end; ++__index) {
+              __state->__fun_(__index, __args...);
+            }
+          },
+          *reinterpret_cast<std::tuple<_As...>*>(__base_t::__arguments_data_));
+      }
     };
 
+    /// Returns the version 2 interface of the backend `__impl`, or null if it only implements
+    /// version 1.
+    inline auto __chunked_interface_of(system_context_replaceability::system_scheduler* __impl)
+      -> system_context_replaceability::system_scheduler_v2* {
+      auto* __v2 = system_context_replaceability::query_system_context<
+        system_context_replaceability::system_scheduler_v2>();
+      using __v1_t = system_context_replaceability::system_scheduler;
+      if (__v2 != nullptr && static_cast<__v1_t*>(__v2) == __impl) {
+        return __v2;
+      }
+      return nullptr;
+    }
+
     /// The state needed to execute the bulk sender created from system context, minus the preallocates space.
     /// The preallocated space is obtained by calling the `__prepare_storage_for_backend` function pointer.
     template <stdexec::sender _Previous, class _Fn, class _Rcvr>
@@ -369,6 +595,7 @@ namespace exec {
           __typed_forward_args_receiver_t(std::forward<_As>(__as)...);
 
         auto __scheduler = __scheduler_;
+        auto __chunked_scheduler = __detail::__chunked_interface_of(__scheduler);
         auto __size = static_cast<uint32_t>(__size_);
 
         auto __storage = __state_.__prepare_storage_for_backend(&__state_);
@@ -376,7 +603,12 @@ namespace exec {
 
         // Schedule the bulk work on the system scheduler.
         // This will invoke `start` on our receiver multiple times, and then a completion signal (e.g., `set_value`).
-        __scheduler->bulk_schedule(__size, __storage, __r);
+        // A backend that implements version 2 of the interface passes whole chunks of items.
+        if (__chunked_scheduler != nullptr) {
+          __chunked_scheduler->bulk_schedule_chunked(__size, __storage, __r);
+        } else {
+          __scheduler->bulk_schedule(__size, __storage, __r);
+        }
       }
 
       /// Invoked when the previous sender completes with "stopped" to stop the entire work.
@@ -534,6 +766,31 @@ namespace exec {
     return stdexec::forward_progress_guarantee::parallel;
   }
 
+  namespace __detail {
+    /// Bulk functor that calls the chunked function `_Fn` with the range of the given chunk.
+    template <class _Fn, std::integral _Shape>
+    struct __chunked_bulk_functor {
+      [[no_unique_address]]
+      _Fn __fun_;
+      /// The size of the whole range.
+      _Shape __shape_;
+      /// The number of chunks the range is split into.
+      uint32_t __num_chunks_;
+
+      template <class... _As>
+      void operator()(uint32_t __chunk, _As&... __as) //
+        noexcept(stdexec::__nothrow_callable<_Fn&, _Shape, _Shape, _As&...>) {
+        // Distribute the remainder evenly over the first chunks.
+        const auto __size = static_cast<std::make_unsigned_t<_Shape>>(__shape_);
+        const auto __small = __size / __num_chunks_;
+        const auto __big_chunks = __size % __num_chunks_;
+        const auto __begin = __chunk * __small + (__chunk < __big_chunks ? __chunk : __big_chunks);
+        const auto __end = __begin + __small + (__chunk < __big_chunks ? 1 : 0);
+        __fun_(static_cast<_Shape>(__begin), static_cast<_Shape>(__end), __as...);
+      }
+    };
+  } // namespace __detail
+
   struct __transform_system_bulk_sender {
     template <class _Data, class _Previous>
     auto operator()(stdexec::bulk_t, _Data&& __data, _Previous&& __previous) const noexcept {
@@ -542,6 +799,22 @@ namespace exec {
         __sched_, static_cast<_Previous&&>(__previous), __shape, std::move(__fn)};
     }
 
+    template <class _Data, class _Previous>
+    auto operator()(bulk_chunked_t, _Data&& __data, _Previous&& __previous) const noexcept {
+      auto [__shape, __fn] = static_cast<_Data&&>(__data);
+      using __shape_t = decltype(__shape);
+      using __fn_t = __detail::__chunked_bulk_functor<decltype(__fn), __shape_t>;
+      // One chunk per hardware thread; the default backend has one pool thread for each.
+      const auto __max_chunks = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+      const auto __num_chunks = static_cast<uint32_t>(
+        std::min(static_cast<std::size_t>(__shape), __max_chunks));
+      return system_bulk_sender<_Previous, __shape_t, __fn_t>{
+        __sched_,
+        static_cast<_Previous&&>(__previous),
+        static_cast<__shape_t>(__num_chunks),
+        __fn_t{std::move(__fn), __shape, __num_chunks}};
+    }
+
     system_scheduler __sched_;
   };
 
@@ -571,6 +844,28 @@ namespace exec {
       return __not_a_sender<stdexec::__name_of<_Sender>>();
     }
   }
+
+  template <stdexec::sender_expr_for<bulk_chunked_t> _Sender, class _Env>
+  auto
+    system_scheduler_domain::transform_sender(_Sender&& __sndr, const _Env& __env) const noexcept {
+    if constexpr (stdexec::__completes_on<_Sender, system_scheduler>) {
+      auto __sched =
+        stdexec::get_completion_scheduler<stdexec::set_value_t>(stdexec::get_env(__sndr));
+      return stdexec::__sexpr_apply(
+        static_cast<_Sender&&>(__sndr), __transform_system_bulk_sender{__sched});
+    } else if constexpr (stdexec::__starts_on<_Sender, system_scheduler, _Env>) {
+      auto __sched = stdexec::get_scheduler(__env);
+      return stdexec::__sexpr_apply(
+        static_cast<_Sender&&>(__sndr), __transform_system_bulk_sender{__sched});
+    } else {
+      static_assert( //
+        stdexec::__starts_on<_Sender, system_scheduler, _Env>
+          || stdexec::__completes_on<_Sender, system_scheduler>,
+        "No system_scheduler instance can be found in the sender's or receiver's "
+        "environment on which to schedule bulk work.");
+      return __not_a_sender<stdexec::__name_of<_Sender>>();
+    }
+  }
 } // namespace exec
 
 #if defined(STDEXEC_SYSTEM_CONTEXT_HEADER_ONLY)
@@ -86,7 +86,7 @@ namespace execpools {
       template <class Fun, class Shape, class... Args>
       using bulk_non_throwing = stdexec::__mbool<
         // If function invocation doesn't throw
-        stdexec::__nothrow_callable<Fun, Shape, Args...> &&
+        stdexec::__nothrow_callable<Fun, Shape, Args&...> &&
         // and emplacing a tuple doesn't throw
         noexcept(stdexec::__decayed_std_tuple<Args...>(std::declval<Args>()...))
         // there's no need to advertise completion with `exception_ptr`
@@ -98,7 +98,7 @@ namespace execpools {
           CvrefSender,
           stdexec::env_of_t<Receiver>,
           stdexec::__q<stdexec::__decayed_std_tuple>,
-          stdexec::__q<stdexec::__std_variant>>;
+          stdexec::__q<stdexec::__nullable_std_variant>>;
 
         variant_t data_;
         DerivedPoolType& pool_;
@@ -145,7 +145,11 @@ namespace execpools {
         void apply(F f) {
           std::visit(
             [&](auto& tupl) -> void {
-              std::apply([&](auto&... args) -> void { f(args...); }, tupl);
+              if constexpr (stdexec::same_as<stdexec::__decay_t<decltype(tupl)>, std::monostate>) {
+                std::terminate();
+              } else {
+                std::apply([&](auto&... args) -> void { f(args...); }, tupl);
+              }
             },
             data_);
         }
@@ -301,9 +305,6 @@ namespace execpools {
         };
       };
 
-      template <class _Ty>
-      using __decay_ref = stdexec::__decay_t<_Ty>&;
-
       template <class SenderId, std::integral Shape, class Fun>
       struct bulk_sender {
         using Sender = stdexec::__t<SenderId>;
@@ -320,9 +321,7 @@ namespace execpools {
           template <class Sender, class... Env>
           using _with_error_invoke_t = stdexec::__eptr_completion_if_t<stdexec::__value_types_t<
             stdexec::__completion_signatures_of_t<Sender, Env...>,
-            stdexec::__mtransform<
-              stdexec::__q1<__decay_ref>,
-              stdexec::__mbind_front_q<bulk_non_throwing, Fun, Shape>>,
+            stdexec::__mbind_front_q<bulk_non_throwing, Fun, Shape>,
             stdexec::__q<stdexec::__mand>>>;
 
           template <class... Tys>
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "__execution_fwd.hpp" // IWYU pragma: keep
+
+// include these after __execution_fwd.hpp
+#include "__concepts.hpp"
+#include "__env.hpp"
+
+#include <cstddef>
+#include <memory>
+
+namespace stdexec {
+  /////////////////////////////////////////////////////////////////////////////
+  // NOT TO SPEC: Allocating the state of detached and shared operations.
+  //
+  // Algorithms that heap-allocate state on behalf of an operation (split, ensure_started,
+  // async_scope::spawn, ...) allocate it with the allocator of the environment they are given,
+  // or with std::allocator if the environment has none.
+  template <class _Env>
+  auto __get_env_allocator(const _Env& __env) noexcept {
+    if constexpr (__callable<get_allocator_t, const _Env&>) {
+      return get_allocator(__env);
+    } else {
+      return std::allocator<std::byte>();
+    }
+  }
+
+  template <class _Env>
+  using __env_allocator_t = decltype(stdexec::__get_env_allocator(__declval<const _Env&>()));
+
+  template <class _Ty, class _Alloc>
+  using __rebind_alloc_t = typename std::allocator_traits<_Alloc>::template rebind_alloc<_Ty>;
+
+  //! Allocates a `_Ty` with `__alloc` rebound to `_Ty` and constructs it from `__args`.
+  template <class _Ty, class _Alloc, class... _Args>
+  auto __allocate_new(const _Alloc& __alloc, _Args&&... __args) -> _Ty* {
+    using _TyAlloc = __rebind_alloc_t<_Ty, _Alloc>;
+    _TyAlloc __ty_alloc{__alloc};
+    _Ty* __ptr = std::allocator_traits<_TyAlloc>::allocate(__ty_alloc, 1);
+    try {
+      std::allocator_traits<_TyAlloc>::construct(
+        __ty_alloc, __ptr, static_cast<_Args&&>(__args)...);
+    } catch (...) {
+      std::allocator_traits<_TyAlloc>::deallocate(__ty_alloc, __ptr, 1);
+      throw;
+    }
+    return __ptr;
+  }
+
+  //! Destroys and deallocates a `_Ty` allocated by `__allocate_new`. `__alloc` may refer to an
+  //! allocator stored in `*__ptr`; it is copied before `*__ptr` is destroyed.
+  template <class _Ty, class _Alloc>
+  void __allocate_delete(const _Alloc& __alloc, _Ty* __ptr) noexcept {
+    using _TyAlloc = __rebind_alloc_t<_Ty, _Alloc>;
+    _TyAlloc __ty_alloc{__alloc};
+    std::allocator_traits<_TyAlloc>::destroy(__ty_alloc, __ptr);
+    std::allocator_traits<_TyAlloc>::deallocate(__ty_alloc, __ptr, 1);
+  }
+} // namespace stdexec
@@ -76,8 +76,8 @@ namespace stdexec {
           static_cast<_Sender&&>(__sndr),
           [&]<class _Env, class _Child>(__ignore, _Env&& __env, _Child&& __child) {
             // The shared state starts life with a ref-count of one.
-            auto* __sh_state =
-              new __shared_state{static_cast<_Child&&>(__child), static_cast<_Env&&>(__env)};
+            auto* __sh_state = __shared_state<_Child, __decay_t<_Env>>::__make(
+              static_cast<_Child&&>(__child), static_cast<_Env&&>(__env));
 
             // Eagerly start the work:
             __sh_state->__try_start(); // cannot throw
@@ -22,11 +22,17 @@
 #include "__env.hpp"
 #include "__meta.hpp"
 #include "__receivers.hpp"
+#include "__spin_loop_pause.hpp"
 #include "__utility.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstddef>
 #include <exception>
 #include <mutex>
+#include <thread>
 #include <utility>
 
 namespace stdexec {
@@ -35,6 +41,27 @@ namespace stdexec {
   namespace __loop {
     class run_loop;
 
+    // NOT TO SPEC: Lets the tests observe how waiters spin and park. Only the tests define it.
+    struct __test_access;
+
+    // NOT TO SPEC: A thread that services a work queue, such as a thread pool worker, can
+    // install a helper for itself. When sync_wait is called on that thread, it uses the helper
+    // to run the thread's other work instead of blocking while it waits, so that nested blocking
+    // neither idles the worker nor deadlocks on work queued behind it.
+    struct __wait_helper {
+      // Runs at most one unit of other work. Returns false if there was none to run.
+      bool (*__help_)(__wait_helper*) noexcept;
+
+      auto __help() noexcept -> bool {
+        return __help_(this);
+      }
+    };
+
+    inline auto __current_wait_helper() noexcept -> __wait_helper*& {
+      thread_local __wait_helper* __helper = nullptr;
+      return __helper;
+    }
+
     struct __task : __immovable {
       __task* __next_ = this;
 
@@ -89,6 +116,7 @@ namespace stdexec {
     class run_loop {
       template <class>
       friend struct __operation;
+      friend __test_access;
      public:
       struct __scheduler {
        private:
@@ -169,16 +197,35 @@ namespace stdexec {
 
       void run();
 
+      // NOT TO SPEC: Like run(), but lets `__helper` run other work whenever the loop is idle.
+      void __run_helping(__wait_helper& __helper);
+
       void finish();
 
      private:
       void __push_back_(__task* __task);
       auto __pop_front_() -> __task*;
+      auto __try_pop_front_() -> __task*;
+      auto __pop_front_locked_() noexcept -> __task*;
+      void __spin_until_ready_() const noexcept;
+      void __publish_ready_() noexcept;
+
+      // The number of spin iterations a waiting thread performs before parking on the
+      // condition variable. It is per-thread so that it adapts to the latency of the work the
+      // thread usually waits for: it grows when spinning pays off and shrinks when it does not.
+      static auto __spin_budget_() noexcept -> std::size_t&;
+      static constexpr std::size_t __min_spin_budget_ = 16;
+      static constexpr std::size_t __max_spin_budget_ = 4096;
 
       std::mutex __mutex_;
       std::condition_variable __cv_;
       __task __head_{{}, &__head_, {&__head_}};
       bool __stop_ = false;
+      // Guarded by __mutex_. Producers skip the notification while nobody is parked.
+      std::size_t __sleepers_ = 0;
+      // Mirrors `__head_.__next_ != &__head_ || __stop_` so that waiters can poll it without
+      // taking the lock.
+      std::atomic<bool> __ready_{false};
     };
 
     template <class _ReceiverId>
@@ -196,25 +243,113 @@ namespace stdexec {
       }
     }
 
+    inline void run_loop::__run_helping(__wait_helper& __helper) {
+      constexpr std::chrono::microseconds __min_park{50};
+      constexpr std::chrono::microseconds __max_park{1000};
+      std::chrono::microseconds __park = __min_park;
+      while (true) {
+        if (__task* __task = __try_pop_front_()) {
+          if (__task == &__head_) {
+            return;
+          }
+          __task->__execute();
+        } else if (__helper.__help()) {
+          __park = __min_park;
+        } else {
+          // Neither this loop nor the helper has work. Park, but wake up periodically to look
+          // for work to help with, because the helper's queues do not notify this loop.
+          std::unique_lock __lock{__mutex_};
+          if (__head_.__next_ == &__head_ && !__stop_) {
+            ++__sleepers_;
+            __cv_.wait_for(
+              __lock, __park, [this] { return __head_.__next_ != &__head_ || __stop_; });
+            --__sleepers_;
+          }
+          __park = std::min(2 * __park, __max_park);
+        }
+      }
+    }
+
     inline void run_loop::finish() {
       std::unique_lock __lock{__mutex_};
       __stop_ = true;
-      __cv_.notify_all();
+      __publish_ready_();
+      if (__sleepers_ != 0) {
+        __cv_.notify_all();
+      }
     }
 
     inline void run_loop::__push_back_(__task* __task) {
       std::unique_lock __lock{__mutex_};
       __task->__next_ = &__head_;
       __head_.__tail_ = __head_.__tail_->__next_ = __task;
-      __cv_.notify_one();
+      __publish_ready_();
+      if (__sleepers_ != 0) {
+        __cv_.notify_one();
+      }
     }
 
     inline auto run_loop::__pop_front_() -> __task* {
+      __spin_until_ready_();
       std::unique_lock __lock{__mutex_};
-      __cv_.wait(__lock, [this] { return __head_.__next_ != &__head_ || __stop_; });
+      // Another thread driving the same loop may have taken the task we saw while spinning.
+      if (__head_.__next_ == &__head_ && !__stop_) {
+        ++__sleepers_;
+        __cv_.wait(__lock, [this] { return __head_.__next_ != &__head_ || __stop_; });
+        --__sleepers_;
+      }
+      return __pop_front_locked_();
+    }
+
+    // Returns nullptr instead of blocking if the loop is empty and not stopped.
+    inline auto run_loop::__try_pop_front_() -> __task* {
+      if (!__ready_.load(std::memory_order_acquire)) {
+        return nullptr;
+      }
+      std::unique_lock __lock{__mutex_};
+      if (__head_.__next_ == &__head_ && !__stop_) {
+        return nullptr;
+      }
+      return __pop_front_locked_();
+    }
+
+    // Must be called with __mutex_ held.
+    inline auto run_loop::__pop_front_locked_() noexcept -> __task* {
       if (__head_.__tail_ == __head_.__next_)
         __head_.__tail_ = &__head_;
-      return std::exchange(__head_.__next_, __head_.__next_->__next_);
+      __task* __front = std::exchange(__head_.__next_, __head_.__next_->__next_);
+      __publish_ready_();
+      return __front;
+    }
+
+    // Polls for work (or a stop request) for up to the current spin budget, and adapts the
+    // budget to the outcome.
+    inline void run_loop::__spin_until_ready_() const noexcept {
+      std::size_t& __budget = __spin_budget_();
+      for (std::size_t __i = 0; __i < __budget; ++__i) {
+        if (__ready_.load(std::memory_order_acquire)) {
+          __budget = std::clamp(2 * __i, __budget, __max_spin_budget_);
+          return;
+        }
+        __spin_loop_pause();
+      }
+      if (__budget != 0 && !__ready_.load(std::memory_order_acquire)) {
+        __budget = std::max(__budget / 2, __min_spin_budget_);
+      }
+    }
+
+    // Must be called with __mutex_ held.
+    inline void run_loop::__publish_ready_() noexcept {
+      __ready_.store(__head_.__next_ != &__head_ || __stop_, std::memory_order_release);
+    }
+
+    inline auto run_loop::__spin_budget_() noexcept -> std::size_t& {
+      // Spinning cannot help when there is no other hardware thread to complete the work.
+      static const std::size_t __initial = std::thread::hardware_concurrency() > 1
+                                           ? __min_spin_budget_
+                                           : 0;
+      thread_local std::size_t __budget = __initial;
+      return __budget;
     }
   } // namespace __loop
 
@@ -18,6 +18,7 @@
 #include "__execution_fwd.hpp" // IWYU pragma: keep
 
 // include these after __execution_fwd.hpp
+#include "__allocator.hpp"
 #include "__basic_sender.hpp"
 #include "__env.hpp"
 #include "__intrusive_slist.hpp"
@@ -242,13 +243,27 @@ namespace stdexec {
         , __shared_op_(connect(static_cast<_CvrefSender&&>(__sndr), __receiver_t{this})) {
       }
 
+      //! Allocates a shared state with the allocator of `__env`. It starts life with a ref-count
+      //! of one.
+      static auto __make(_CvrefSender&& __sndr, _Env __env) -> __shared_state* {
+        auto __alloc = stdexec::__get_env_allocator(__env);
+        return stdexec::__allocate_new<__shared_state>(
+          __alloc, static_cast<_CvrefSender&&>(__sndr), static_cast<_Env&&>(__env));
+      }
+
+      void __delete_self() noexcept {
+        // The allocator is a copy, so it survives the destruction of __env_.
+        auto __alloc = stdexec::__get_env_allocator(__env_);
+        stdexec::__allocate_delete(__alloc, this);
+      }
+
       void __inc_ref() noexcept {
         __ref_count_.fetch_add(2ul, std::memory_order_relaxed);
       }
 
       void __dec_ref() noexcept {
         if (2ul == __ref_count_.fetch_sub(2ul, std::memory_order_acq_rel)) {
-          delete this;
+          __delete_self();
         }
       }
 
@@ -262,7 +277,7 @@ namespace stdexec {
 
       void __set_completed() noexcept {
         if (1ul == __ref_count_.fetch_sub(1ul, std::memory_order_acq_rel)) {
-          delete this;
+          __delete_self();
         }
       }
 
@@ -73,8 +73,8 @@ namespace stdexec {
           static_cast<_Sender&&>(__sndr),
           [&]<class _Env, class _Child>(__ignore, _Env&& __env, _Child&& __child) {
             // The shared state starts life with a ref-count of one.
-            auto* __sh_state =
-              new __shared_state{static_cast<_Child&&>(__child), static_cast<_Env&&>(__env)};
+            auto* __sh_state = __shared_state<_Child, __decay_t<_Env>>::__make(
+              static_cast<_Child&&>(__child), static_cast<_Env&&>(__env));
 
             return __make_sexpr<__split_t>(__box{__split_t(), __sh_state});
           });
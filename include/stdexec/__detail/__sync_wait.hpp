@@ -238,7 +238,9 @@ namespace stdexec {
       ///         `run_loop` instance until the sender completes. Additional work
       ///         can be delegated to the `run_loop` by scheduling work on the
       ///         scheduler returned by calling `get_delegation_scheduler` on the
-      ///         receiver's environment.
+      ///         receiver's environment. When called on a worker thread of
+      ///         `exec::static_thread_pool`, the worker keeps executing pool
+      ///         tasks while it waits.
       ///
       /// @pre The sender must have a exactly one value completion signature. That
       ///         is, it can only complete successfully in one way, with a single
@@ -267,8 +269,13 @@ namespace stdexec {
           connect(static_cast<_Sender&&>(__sndr), __receiver_t<_Sender>{&__local_state, &__result});
         stdexec::start(__op_state);
 
-        // Wait for the variant to be filled in.
-        __local_state.__loop_.run();
+        // Wait for the variant to be filled in. If this thread services a work queue, keep
+        // running its work in the meantime.
+        if (__loop::__wait_helper* __helper = __loop::__current_wait_helper()) {
+          __local_state.__loop_.__run_helping(*__helper);
+        } else {
+          __local_state.__loop_.run();
+        }
 
         if (__local_state.__eptr_) {
           std::rethrow_exception(static_cast<std::exception_ptr&&>(__local_state.__eptr_));
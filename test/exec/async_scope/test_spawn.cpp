@@ -3,6 +3,7 @@
 #include "test_common/schedulers.hpp"
 #include "test_common/receivers.hpp"
 #include "test_common/type_helpers.hpp"
+#include "test_common/allocators.hpp"
 
 namespace ex = stdexec;
 using exec::async_scope;
@@ -230,4 +231,23 @@ namespace {
     // TODO: reenable this
     // REQUIRE(P2519::__scope::empty(scope));
   }
+
+  // NOT TO SPEC
+  TEST_CASE("spawn allocates its operation with the env's allocator", "[async_scope][spawn]") {
+    allocation_counts counts;
+    impulse_scheduler sch;
+    async_scope scope;
+    bool executed = false;
+
+    scope.spawn(
+      ex::starts_on(sch, ex::just() | ex::then([&] { executed = true; })),
+      ex::prop{ex::get_allocator, counting_allocator<std::byte>{counts}});
+    CHECK(counts.allocated == 1);
+    CHECK(counts.alive == 1);
+
+    sch.start_next();
+    CHECK(executed);
+    CHECK(counts.alive == 0);
+    sync_wait(scope.on_empty());
+  }
 } // namespace
@@ -5,6 +5,7 @@
 #include "test_common/schedulers.hpp"
 #include "test_common/receivers.hpp"
 #include "test_common/type_helpers.hpp"
+#include "test_common/allocators.hpp"
 
 namespace ex = stdexec;
 using exec::async_scope;
@@ -461,4 +462,49 @@ namespace {
     // ex::start(op);
     expect_empty(scope);
   }
+
+  // NOT TO SPEC
+  TEST_CASE(
+    "spawn_future allocates its state with the env's allocator",
+    "[async_scope][spawn_future]") {
+    allocation_counts counts;
+    auto env = ex::prop{ex::get_allocator, counting_allocator<std::byte>{counts}};
+    async_scope scope;
+    {
+      // The future is consumed.
+      auto [v] = sync_wait(scope.spawn_future(ex::just(42), env)).value();
+      CHECK(v == 42);
+    }
+    {
+      // The future is dropped before the work completes.
+      impulse_scheduler sch;
+      (void) scope.spawn_future(ex::starts_on(sch, ex::just(42)), env);
+      CHECK(counts.alive == 1);
+      sch.start_next();
+    }
+    sync_wait(scope.on_empty());
+    CHECK(counts.allocated == 2);
+    CHECK(counts.alive == 0);
+  }
+
+  TEST_CASE(
+    "spawn_future hands off results that race with the consumer",
+    "[async_scope][spawn_future]") {
+    exec::static_thread_pool pool{2};
+    allocation_counts counts;
+    auto env = ex::prop{ex::get_allocator, counting_allocator<std::byte>{counts}};
+    async_scope scope;
+    for (int i = 0; i < 1000; ++i) {
+      auto fut = scope.spawn_future(ex::starts_on(pool.get_scheduler(), ex::just(i)), env);
+      if (i % 2 == 0) {
+        // Either the work or the consumer comes second.
+        auto [v] = sync_wait(std::move(fut)).value();
+        CHECK(v == i);
+      }
+      // Odd futures are dropped while the work may be running.
+    }
+    sync_wait(scope.on_empty());
+    CHECK(counts.allocated == 1000);
+    CHECK(counts.alive == 0);
+  }
 } // namespace
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <exec/admit.hpp>
+#include <exec/async_latch.hpp>
+#include <exec/async_scope.hpp>
+#include <exec/static_thread_pool.hpp>
+#include <exec/timed_thread_scheduler.hpp>
+#include <stdexec/execution.hpp>
+
+#include <catch2/catch.hpp>
+
+#include "test_common/receivers.hpp"
+
+#include <atomic>
+#include <chrono>
+
+namespace ex = stdexec;
+using namespace std::chrono_literals;
+
+namespace {
+  enum class outcome {
+    pending,
+    value,
+    shed,
+    stopped
+  };
+
+  template <class Sender>
+  auto record(Sender&& sndr, std::atomic<outcome>& result) {
+    return static_cast<Sender&&>(sndr) | ex::then([&result](auto&&...) { result = outcome::value; })
+         | ex::upon_error([&result](auto&&) { result = outcome::shed; })
+         | ex::upon_stopped([&result] { result = outcome::stopped; });
+  }
+
+  TEST_CASE("admit starts operations within the limit", "[types][admit]") {
+    exec::admission_limiter limiter{exec::static_limit{2}};
+    auto result = ex::sync_wait(exec::admit(ex::just(42), limiter));
+    REQUIRE(result.has_value());
+    CHECK(std::get<0>(*result) == 42);
+    CHECK(limiter.in_flight() == 0);
+
+    auto piped = ex::sync_wait(ex::just(1, 2) | exec::admit(limiter));
+    REQUIRE(piped.has_value());
+    CHECK(*piped == std::tuple{1, 2});
+  }
+
+  TEST_CASE("admit sheds operations beyond the limit", "[types][admit]") {
+    exec::admission_limiter limiter{exec::static_limit{1}};
+    exec::async_latch latch{1};
+    std::atomic<outcome> first{outcome::pending};
+    std::atomic<outcome> second{outcome::pending};
+    auto op1 = ex::connect(record(exec::admit(latch.wait(), limiter), first), empty_recv::recv0{});
+    auto op2 = ex::connect(record(exec::admit(latch.wait(), limiter), second), empty_recv::recv0{});
+    ex::start(op1);
+    CHECK(limiter.in_flight() == 1);
+    ex::start(op2);
+    CHECK(second == outcome::shed);
+    CHECK(first == outcome::pending);
+
+    latch.count_down();
+    CHECK(first == outcome::value);
+    CHECK(limiter.in_flight() == 0);
+  }
+
+  TEST_CASE("admit queues operations until their deadline", "[types][admit]") {
+    exec::timed_thread_context timer;
+    exec::admission_limiter limiter{exec::static_limit{1}};
+    exec::async_latch latch{1};
+    std::atomic<outcome> first{outcome::pending};
+    std::atomic<outcome> second{outcome::pending};
+    auto op1 = ex::connect(record(exec::admit(latch.wait(), limiter), first), empty_recv::recv0{});
+    ex::start(op1);
+    ex::sync_wait(
+      record(exec::admit(ex::just(), limiter, timer.get_scheduler(), 10ms), second));
+    CHECK(second == outcome::shed);
+    CHECK(first == outcome::pending);
+
+    latch.count_down();
+    CHECK(first == outcome::value);
+  }
+
+  TEST_CASE("admit hands freed slots to queued operations", "[types][admit]") {
+    exec::timed_thread_context timer;
+    exec::admission_limiter limiter{exec::static_limit{1}};
+    exec::async_latch latch{1};
+    exec::async_scope scope;
+    std::atomic<outcome> first{outcome::pending};
+    std::atomic<outcome> second{outcome::pending};
+    scope.spawn(record(exec::admit(latch.wait(), limiter), first));
+    scope.spawn(record(exec::admit(ex::just(), limiter, timer.get_scheduler(), 1h), second));
+    CHECK(second == outcome::pending);
+
+    latch.count_down();
+    ex::sync_wait(scope.on_empty());
+    CHECK(first == outcome::value);
+    CHECK(second == outcome::value);
+    CHECK(limiter.in_flight() == 0);
+  }
+
+  TEST_CASE("admit stops queued operations", "[types][admit]") {
+    exec::timed_thread_context timer;
+    exec::admission_limiter limiter{exec::static_limit{1}};
+    exec::async_latch latch{1};
+    std::atomic<outcome> first{outcome::pending};
+    std::atomic<outcome> second{outcome::pending};
+    ex::inplace_stop_source stop_source;
+    auto op1 = ex::connect(record(exec::admit(latch.wait(), limiter), first), empty_recv::recv0{});
+    ex::start(op1);
+
+    exec::async_scope scope;
+    scope.spawn(record(
+      ex::__write_env(
+        exec::admit(ex::just(), limiter, timer.get_scheduler(), 1h),
+        ex::prop{ex::get_stop_token, stop_source.get_token()}),
+      second));
+    CHECK(second == outcome::pending);
+    stop_source.request_stop();
+    ex::sync_wait(scope.on_empty());
+    CHECK(second == outcome::stopped);
+
+    // The stopped operation does not take the slot.
+    latch.count_down();
+    CHECK(first == outcome::value);
+    CHECK(limiter.in_flight() == 0);
+  }
+
+  TEST_CASE("aimd_limit grows additively and backs off multiplicatively", "[types][admit]") {
+    exec::aimd_limit aimd{.initial_limit = 10, .min_limit = 2, .max_limit = 11, .timeout = 1s};
+    CHECK(aimd.update(10, 5, 1ms, false) == 11);
+    CHECK(aimd.update(11, 6, 1ms, false) == 11);
+    CHECK(aimd.update(10, 1, 1ms, false) == 10);
+    CHECK(aimd.update(10, 5, 1ms, true) == 9);
+    CHECK(aimd.update(10, 5, 2s, false) == 9);
+    CHECK(aimd.update(2, 2, 1ms, true) == 2);
+  }
+
+  TEST_CASE("gradient_limit follows latency", "[types][admit]") {
+    exec::gradient_limit gradient{.initial_limit = 20, .max_limit = 200};
+    std::size_t limit = 20;
+    for (int i = 0; i < 50; ++i) {
+      limit = gradient.update(limit, limit, 1ms, false);
+    }
+    const std::size_t grown = limit;
+    CHECK(grown > 20);
+
+    for (int i = 0; i < 20; ++i) {
+      limit = gradient.update(limit, limit, 10ms, false);
+    }
+    CHECK(limit < grown);
+
+    // With little load the limit stays where it is.
+    CHECK(gradient.update(limit, 0, 1ms, false) == limit);
+  }
+
+  TEST_CASE("admission_limiter adapts its limit to completions", "[types][admit]") {
+    exec::admission_limiter limiter{exec::aimd_limit{.initial_limit = 4, .min_limit = 1}};
+    for (int i = 0; i < 8; ++i) {
+      std::atomic<outcome> result{outcome::pending};
+      ex::sync_wait(record(exec::admit(ex::just_error(42), limiter), result));
+      CHECK(result == outcome::shed);
+    }
+    CHECK(limiter.limit() == 1);
+    CHECK(limiter.in_flight() == 0);
+  }
+
+  TEST_CASE("admit bounds concurrency on a thread pool", "[types][admit]") {
+    constexpr int num_tasks = 500;
+    exec::static_thread_pool pool{4};
+    exec::timed_thread_context timer;
+    exec::admission_limiter limiter{exec::static_limit{3}};
+    exec::async_scope scope;
+    std::atomic<int> running{0};
+    std::atomic<int> max_running{0};
+    std::atomic<int> done{0};
+    for (int i = 0; i < num_tasks; ++i) {
+      auto work = ex::just() | ex::then([&] {
+                    const int now = ++running;
+                    int max = max_running.load();
+                    while (now > max && !max_running.compare_exchange_weak(max, now)) {
+                    }
+                    --running;
+                    ++done;
+                  });
+      scope.spawn(
+        ex::starts_on(
+          pool.get_scheduler(), exec::admit(std::move(work), limiter, timer.get_scheduler(), 1h))
+        | ex::upon_error([](auto&&) { }));
+    }
+    ex::sync_wait(scope.on_empty());
+    CHECK(done == num_tasks);
+    CHECK(max_running <= 3);
+    CHECK(limiter.in_flight() == 0);
+  }
+} // namespace
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <exec/async_barrier.hpp>
+#include <exec/async_scope.hpp>
+#include <exec/repeat_n.hpp>
+#include <exec/static_thread_pool.hpp>
+#include <stdexec/execution.hpp>
+
+#include <catch2/catch.hpp>
+
+#include "test_common/receivers.hpp"
+
+#include <atomic>
+
+namespace ex = stdexec;
+
+namespace {
+  TEST_CASE("async_barrier completes a phase on the last arrival", "[types][async_barrier]") {
+    exec::async_barrier barrier{3};
+    int released = 0;
+    auto op1 = ex::connect(
+      barrier.arrive_and_wait() | ex::then([&] { ++released; }), empty_recv::recv0{});
+    auto op2 = ex::connect(
+      barrier.arrive_and_wait() | ex::then([&] { ++released; }), empty_recv::recv0{});
+    ex::start(op1);
+    ex::start(op2);
+    CHECK(released == 0);
+    barrier.arrive();
+    CHECK(released == 2);
+  }
+
+  TEST_CASE("async_barrier is reusable", "[types][async_barrier]") {
+    exec::async_barrier barrier{2};
+    for (int phase = 0; phase < 3; ++phase) {
+      bool released = false;
+      auto op = ex::connect(
+        barrier.arrive_and_wait() | ex::then([&] { released = true; }), empty_recv::recv0{});
+      ex::start(op);
+      CHECK_FALSE(released);
+      CHECK(ex::sync_wait(barrier.arrive_and_wait()).has_value());
+      CHECK(released);
+    }
+  }
+
+  TEST_CASE("async_barrier arrive_and_drop shrinks later phases", "[types][async_barrier]") {
+    exec::async_barrier barrier{2};
+    barrier.arrive_and_drop();
+    // Only one participant remains.
+    CHECK(ex::sync_wait(barrier.arrive_and_wait()).has_value());
+    CHECK(ex::sync_wait(barrier.arrive_and_wait()).has_value());
+  }
+
+  TEST_CASE("async_barrier synchronizes phases across threads", "[types][async_barrier]") {
+    exec::static_thread_pool pool{4};
+    constexpr int num_workers = 8;
+    constexpr int num_phases = 50;
+    exec::async_barrier barrier{num_workers};
+    exec::async_scope scope;
+    std::atomic<int> arrivals{0};
+    std::atomic<bool> out_of_phase{false};
+    for (int w = 0; w < num_workers; ++w) {
+      scope.spawn(ex::starts_on(
+        pool.get_scheduler(),
+        ex::just() | ex::let_value([&] {
+          return exec::repeat_n(
+            ex::just() | ex::let_value([&] {
+              const int n = arrivals.fetch_add(1);
+              return barrier.arrive_and_wait() | ex::then([&, n] {
+                       // Every worker arrived in the phase before anyone left it.
+                       if (arrivals.load() < (n / num_workers + 1) * num_workers) {
+                         out_of_phase = true;
+                       }
+                     });
+            }),
+            num_phases);
+        })));
+    }
+    ex::sync_wait(scope.on_empty());
+    CHECK(arrivals.load() == num_workers * num_phases);
+    CHECK_FALSE(out_of_phase.load());
+  }
+} // namespace
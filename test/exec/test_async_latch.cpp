@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <exec/async_latch.hpp>
+#include <exec/async_scope.hpp>
+#include <exec/static_thread_pool.hpp>
+#include <stdexec/execution.hpp>
+
+#include <catch2/catch.hpp>
+
+#include "test_common/receivers.hpp"
+
+#include <atomic>
+
+namespace ex = stdexec;
+
+namespace {
+  TEST_CASE("async_latch releases waiters when it reaches zero", "[types][async_latch]") {
+    exec::async_latch latch{2};
+    bool released = false;
+    auto op = ex::connect(latch.wait() | ex::then([&] { released = true; }), empty_recv::recv0{});
+    ex::start(op);
+    CHECK_FALSE(released);
+    latch.count_down();
+    CHECK_FALSE(released);
+    CHECK_FALSE(latch.try_wait());
+    latch.count_down();
+    CHECK(released);
+    CHECK(latch.try_wait());
+    // Waiting on a released latch completes immediately.
+    CHECK(ex::sync_wait(latch.wait()).has_value());
+  }
+
+  TEST_CASE("async_latch wait can be cancelled", "[types][async_latch]") {
+    exec::async_latch latch{1};
+    ex::inplace_stop_source stop_source;
+    bool stopped = false;
+    auto op = ex::connect(
+      ex::__write_env(latch.wait(), ex::prop{ex::get_stop_token, stop_source.get_token()})
+        | ex::upon_stopped([&] { stopped = true; }),
+      empty_recv::recv0{});
+    ex::start(op);
+    stop_source.request_stop();
+    CHECK(stopped);
+    latch.count_down();
+  }
+
+  TEST_CASE("async_latch joins work from many threads", "[types][async_latch]") {
+    exec::static_thread_pool pool{4};
+    constexpr int num_tasks = 1000;
+    exec::async_latch latch{num_tasks};
+    exec::async_scope scope;
+    std::atomic<int> done{0};
+    for (int i = 0; i < num_tasks; ++i) {
+      scope.spawn(ex::schedule(pool.get_scheduler()) | ex::then([&] {
+                    done.fetch_add(1);
+                    latch.count_down();
+                  }));
+    }
+    ex::sync_wait(latch.wait());
+    CHECK(done.load() == num_tasks);
+    ex::sync_wait(scope.on_empty());
+  }
+} // namespace
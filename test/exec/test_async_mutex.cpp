@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <exec/async_mutex.hpp>
+#include <exec/async_scope.hpp>
+#include <exec/static_thread_pool.hpp>
+#include <stdexec/execution.hpp>
+
+#include <catch2/catch.hpp>
+
+#include "test_common/receivers.hpp"
+#include "test_common/schedulers.hpp"
+
+#include <vector>
+
+namespace ex = stdexec;
+
+namespace {
+  TEST_CASE("async_mutex locks without waiting when it is free", "[types][async_mutex]") {
+    exec::async_mutex mutex;
+    STATIC_REQUIRE(ex::sender_of<decltype(mutex.lock()), ex::set_value_t()>);
+    bool locked = false;
+    auto op = ex::connect(mutex.lock() | ex::then([&] { locked = true; }), empty_recv::recv0{});
+    ex::start(op);
+    CHECK(locked);
+    CHECK_FALSE(mutex.try_lock());
+    mutex.unlock();
+    CHECK(mutex.try_lock());
+    mutex.unlock();
+  }
+
+  TEST_CASE("async_mutex hands the lock to waiters in FIFO order", "[types][async_mutex]") {
+    exec::async_mutex mutex;
+    REQUIRE(mutex.try_lock());
+    std::vector<int> order;
+    auto op1 = ex::connect(mutex.lock() | ex::then([&] { order.push_back(1); }), empty_recv::recv0{});
+    auto op2 = ex::connect(mutex.lock() | ex::then([&] { order.push_back(2); }), empty_recv::recv0{});
+    ex::start(op1);
+    ex::start(op2);
+    CHECK(order.empty());
+    // A waiter is queued, so the lock cannot be taken out of turn.
+    mutex.unlock();
+    CHECK(order == std::vector{1});
+    CHECK_FALSE(mutex.try_lock());
+    mutex.unlock();
+    CHECK(order == std::vector{1, 2});
+    mutex.unlock();
+    CHECK(mutex.try_lock());
+    mutex.unlock();
+  }
+
+  TEST_CASE("async_mutex lock can be cancelled while waiting", "[types][async_mutex]") {
+    exec::async_mutex mutex;
+    REQUIRE(mutex.try_lock());
+    ex::inplace_stop_source stop_source;
+    bool stopped = false;
+    bool locked = false;
+    auto op1 = ex::connect(
+      ex::__write_env(mutex.lock(), ex::prop{ex::get_stop_token, stop_source.get_token()})
+        | ex::upon_stopped([&] { stopped = true; }),
+      empty_recv::recv0{});
+    auto op2 = ex::connect(mutex.lock() | ex::then([&] { locked = true; }), empty_recv::recv0{});
+    ex::start(op1);
+    ex::start(op2);
+    stop_source.request_stop();
+    CHECK(stopped);
+    CHECK_FALSE(locked);
+    mutex.unlock();
+    CHECK(locked);
+    mutex.unlock();
+  }
+
+  TEST_CASE("async_mutex lock completes with stopped if stop was requested", "[types][async_mutex]") {
+    exec::async_mutex mutex;
+    REQUIRE(mutex.try_lock());
+    ex::inplace_stop_source stop_source;
+    stop_source.request_stop();
+    auto result = ex::sync_wait(
+      ex::__write_env(mutex.lock(), ex::prop{ex::get_stop_token, stop_source.get_token()}));
+    CHECK_FALSE(result.has_value());
+    mutex.unlock();
+    CHECK(mutex.try_lock());
+    mutex.unlock();
+  }
+
+  TEST_CASE(
+    "async_mutex unlocks if a waiter fails to resume on its scheduler",
+    "[types][async_mutex]") {
+    exec::async_mutex mutex;
+    REQUIRE(mutex.try_lock());
+    auto lock =
+      ex::__write_env(mutex.lock(), ex::prop{ex::get_scheduler, error_scheduler<int>{42}});
+    STATIC_REQUIRE(ex::sender_of<decltype(lock), ex::set_error_t(int)>);
+    int error = 0;
+    auto op = ex::connect(
+      std::move(lock) | ex::upon_error([&](int err) { error = err; }), empty_recv::recv0{});
+    ex::start(op);
+    mutex.unlock();
+    CHECK(error == 42);
+    CHECK(mutex.try_lock());
+    mutex.unlock();
+  }
+
+  TEST_CASE("async_mutex provides mutual exclusion across threads", "[types][async_mutex]") {
+    exec::static_thread_pool pool{4};
+    exec::async_mutex mutex;
+    exec::async_scope scope;
+    int counter = 0;
+    constexpr int num_tasks = 10000;
+    for (int i = 0; i < num_tasks; ++i) {
+      scope.spawn(
+        ex::starts_on(pool.get_scheduler(), mutex.lock()) | ex::then([&] {
+          ++counter;
+          mutex.unlock();
+        }));
+    }
+    ex::sync_wait(scope.on_empty());
+    CHECK(counter == num_tasks);
+  }
+} // namespace
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <exec/async_pool.hpp>
+#include <exec/async_scope.hpp>
+#include <exec/static_thread_pool.hpp>
+#include <stdexec/execution.hpp>
+
+#include <catch2/catch.hpp>
+
+#include "test_common/receivers.hpp"
+
+#include <atomic>
+#include <memory>
+#include <set>
+#include <string>
+
+namespace ex = stdexec;
+
+namespace {
+  struct two_node_policy {
+    auto num_nodes() const noexcept -> std::size_t {
+      return 2;
+    }
+
+    auto num_cpus(int) const noexcept -> std::size_t {
+      return 1;
+    }
+
+    auto bind_to_node(int) const noexcept -> int {
+      return 0;
+    }
+
+    auto thread_index_to_node(std::size_t index) const noexcept -> int {
+      return static_cast<int>(index % 2);
+    }
+  };
+
+  TEST_CASE("async_pool creates its objects up front", "[types][async_pool]") {
+    int created = 0;
+    exec::async_pool<std::string> pool{3, [&] { return std::to_string(created++); }};
+    CHECK(created == 3);
+
+    std::set<std::string> seen;
+    {
+      auto a = pool.try_acquire();
+      auto b = pool.try_acquire();
+      auto c = pool.try_acquire();
+      REQUIRE(a);
+      REQUIRE(b);
+      REQUIRE(c);
+      CHECK_FALSE(pool.try_acquire());
+      seen = {*a, *b, *c};
+    }
+    CHECK(seen == std::set<std::string>{"0", "1", "2"});
+    CHECK(created == 3);
+  }
+
+  TEST_CASE("async_pool leases give their object back", "[types][async_pool]") {
+    exec::async_pool<int> pool{1, [] { return 42; }};
+    auto result = ex::sync_wait(pool.acquire());
+    REQUIRE(result.has_value());
+    auto& [lease] = *result;
+    CHECK(*lease == 42);
+    *lease = 7;
+    CHECK_FALSE(pool.try_acquire());
+
+    auto moved = std::move(lease);
+    CHECK_FALSE(lease);
+    CHECK(moved.get() != nullptr);
+    moved.reset();
+    CHECK_FALSE(moved);
+
+    auto again = pool.try_acquire();
+    REQUIRE(again);
+    CHECK(*again == 7);
+  }
+
+  TEST_CASE("async_pool waiters are served in order", "[types][async_pool]") {
+    exec::async_pool<int> pool{1, [] { return 0; }};
+    auto held = pool.try_acquire();
+    REQUIRE(held);
+
+    std::vector<int> order;
+    exec::async_pool<int>::lease first;
+    auto op1 = ex::connect(
+      pool.acquire() | ex::then([&](exec::async_pool<int>::lease l) {
+        order.push_back(1);
+        first = std::move(l);
+      }),
+      empty_recv::recv0{});
+    auto op2 = ex::connect(
+      pool.acquire() | ex::then([&](exec::async_pool<int>::lease) { order.push_back(2); }),
+      empty_recv::recv0{});
+    ex::start(op1);
+    ex::start(op2);
+    CHECK(order.empty());
+
+    held.reset();
+    CHECK(order == std::vector{1});
+    first.reset();
+    CHECK(order == std::vector{1, 2});
+  }
+
+  TEST_CASE("async_pool waiters can be cancelled", "[types][async_pool]") {
+    exec::async_pool<int> pool{1, [] { return 0; }};
+    auto held = pool.try_acquire();
+    REQUIRE(held);
+
+    ex::inplace_stop_source stop_source;
+    bool stopped = false;
+    auto op = ex::connect(
+      ex::__write_env(pool.acquire(), ex::prop{ex::get_stop_token, stop_source.get_token()})
+        | ex::then([](exec::async_pool<int>::lease) { })
+        | ex::upon_stopped([&] { stopped = true; }),
+      empty_recv::recv0{});
+    ex::start(op);
+    stop_source.request_stop();
+    CHECK(stopped);
+
+    // The cancelled waiter does not take the object.
+    held.reset();
+    CHECK(pool.try_acquire());
+  }
+
+  TEST_CASE("async_pool passes the node to the factory", "[types][async_pool]") {
+    exec::async_pool<int> pool{4, [](int node) { return node; }, two_node_policy{}};
+    std::vector<exec::async_pool<int>::lease> leases;
+    int on_node[2] = {0, 0};
+    while (auto lease = pool.try_acquire()) {
+      ++on_node[*lease];
+      leases.push_back(std::move(lease));
+    }
+    CHECK(leases.size() == 4);
+    CHECK(on_node[0] == 2);
+    CHECK(on_node[1] == 2);
+  }
+
+  TEST_CASE("async_pool takes objects from other nodes", "[types][async_pool]") {
+    exec::async_pool<int> pool{2, [](int node) { return node; }, two_node_policy{}};
+    const int local = exec::_get_current_numa_node() % 2;
+    auto a = pool.try_acquire();
+    REQUIRE(a);
+    CHECK(*a == local);
+    auto b = ex::sync_wait(pool.acquire());
+    REQUIRE(b.has_value());
+    CHECK(*std::get<0>(*b) == 1 - local);
+    CHECK_FALSE(pool.try_acquire());
+  }
+
+  TEST_CASE("async_pool never hands out an object twice", "[types][async_pool]") {
+    struct resource {
+      std::atomic<int> users{0};
+    };
+
+    constexpr int num_tasks = 2000;
+    exec::static_thread_pool threads{4};
+    exec::async_pool<std::unique_ptr<resource>> pool{
+      3, [] { return std::make_unique<resource>(); }};
+    exec::async_scope scope;
+    std::atomic<int> overlaps{0};
+    std::atomic<int> done{0};
+    for (int i = 0; i < num_tasks; ++i) {
+      scope.spawn(
+        ex::starts_on(
+          threads.get_scheduler(),
+          pool.acquire() | ex::then([&](exec::async_pool<std::unique_ptr<resource>>::lease l) {
+            if ((*l)->users.fetch_add(1) != 0) {
+              ++overlaps;
+            }
+            (*l)->users.fetch_sub(1);
+            ++done;
+          })));
+    }
+    ex::sync_wait(scope.on_empty());
+    CHECK(done == num_tasks);
+    CHECK(overlaps == 0);
+  }
+} // namespace
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <exec/async_scope.hpp>
+#include <exec/async_semaphore.hpp>
+#include <exec/static_thread_pool.hpp>
+#include <stdexec/execution.hpp>
+
+#include <catch2/catch.hpp>
+
+#include "test_common/receivers.hpp"
+#include "test_common/schedulers.hpp"
+
+#include <atomic>
+
+namespace ex = stdexec;
+
+namespace {
+  TEST_CASE("async_semaphore hands out its permits", "[types][async_semaphore]") {
+    exec::async_semaphore sem{2};
+    CHECK(ex::sync_wait(sem.acquire()).has_value());
+    CHECK(sem.try_acquire());
+    CHECK_FALSE(sem.try_acquire());
+    sem.release(2);
+    CHECK(sem.try_acquire());
+    CHECK(sem.try_acquire());
+    CHECK_FALSE(sem.try_acquire());
+    sem.release(2);
+  }
+
+  TEST_CASE("async_semaphore release wakes as many waiters as permits", "[types][async_semaphore]") {
+    exec::async_semaphore sem{0};
+    int acquired = 0;
+    auto op1 = ex::connect(sem.acquire() | ex::then([&] { ++acquired; }), empty_recv::recv0{});
+    auto op2 = ex::connect(sem.acquire() | ex::then([&] { ++acquired; }), empty_recv::recv0{});
+    auto op3 = ex::connect(sem.acquire() | ex::then([&] { ++acquired; }), empty_recv::recv0{});
+    ex::start(op1);
+    ex::start(op2);
+    ex::start(op3);
+    CHECK(acquired == 0);
+    sem.release(2);
+    CHECK(acquired == 2);
+    // The remaining waiter takes the next permit, so none is left over.
+    sem.release(2);
+    CHECK(acquired == 3);
+    CHECK(sem.try_acquire());
+    CHECK_FALSE(sem.try_acquire());
+  }
+
+  TEST_CASE("async_semaphore waiters can be cancelled", "[types][async_semaphore]") {
+    exec::async_semaphore sem{0};
+    ex::inplace_stop_source stop_source;
+    bool stopped = false;
+    auto op = ex::connect(
+      ex::__write_env(sem.acquire(), ex::prop{ex::get_stop_token, stop_source.get_token()})
+        | ex::upon_stopped([&] { stopped = true; }),
+      empty_recv::recv0{});
+    ex::start(op);
+    stop_source.request_stop();
+    CHECK(stopped);
+    // The cancelled waiter does not consume the permit.
+    sem.release();
+    CHECK(sem.try_acquire());
+  }
+
+  TEST_CASE(
+    "async_semaphore takes the permit back if a waiter fails to resume on its scheduler",
+    "[types][async_semaphore]") {
+    exec::async_semaphore sem{0};
+    bool stopped = false;
+    auto op = ex::connect(
+      ex::__write_env(sem.acquire(), ex::prop{ex::get_scheduler, stopped_scheduler{}})
+        | ex::upon_stopped([&] { stopped = true; }),
+      empty_recv::recv0{});
+    ex::start(op);
+    sem.release();
+    CHECK(stopped);
+    CHECK(sem.try_acquire());
+    CHECK_FALSE(sem.try_acquire());
+  }
+
+  TEST_CASE("async_semaphore bounds concurrency across threads", "[types][async_semaphore]") {
+    exec::static_thread_pool pool{4};
+    exec::async_semaphore sem{2};
+    exec::async_scope scope;
+    std::atomic<int> inside{0};
+    std::atomic<int> max_inside{0};
+    std::atomic<int> done{0};
+    constexpr int num_tasks = 5000;
+    for (int i = 0; i < num_tasks; ++i) {
+      scope.spawn(
+        ex::starts_on(pool.get_scheduler(), sem.acquire()) | ex::then([&] {
+          const int now = inside.fetch_add(1) + 1;
+          int max = max_inside.load();
+          while (now > max && !max_inside.compare_exchange_weak(max, now)) {
+          }
+          inside.fetch_sub(1);
+          done.fetch_add(1);
+          sem.release();
+        }));
+    }
+    ex::sync_wait(scope.on_empty());
+    CHECK(done.load() == num_tasks);
+    CHECK(max_inside.load() <= 2);
+  }
+
+  TEST_CASE("async_semaphore cancellation races with release", "[types][async_semaphore]") {
+    exec::static_thread_pool pool{2};
+    for (int round = 0; round < 200; ++round) {
+      exec::async_semaphore sem{0};
+      exec::async_scope scope;
+      ex::inplace_stop_source stop_source;
+      std::atomic<int> acquired{0};
+      for (int i = 0; i < 8; ++i) {
+        scope.spawn(
+          ex::__write_env(sem.acquire(), ex::prop{ex::get_stop_token, stop_source.get_token()})
+          | ex::then([&] { acquired.fetch_add(1); }));
+      }
+      auto stopper = ex::schedule(pool.get_scheduler())
+                   | ex::then([&] { stop_source.request_stop(); });
+      scope.spawn(std::move(stopper));
+      sem.release(4);
+      ex::sync_wait(scope.on_empty());
+      // Permits that were not handed to a waiter are still available.
+      int left = 0;
+      while (sem.try_acquire()) {
+        ++left;
+      }
+      CHECK(acquired.load() + left == 4);
+    }
+  }
+} // namespace
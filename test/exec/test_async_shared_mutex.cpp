@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <exec/async_scope.hpp>
+#include <exec/async_shared_mutex.hpp>
+#include <exec/static_thread_pool.hpp>
+#include <stdexec/execution.hpp>
+
+#include <catch2/catch.hpp>
+
+#include "test_common/receivers.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace ex = stdexec;
+
+namespace {
+  TEST_CASE("async_shared_mutex admits many readers", "[types][async_shared_mutex]") {
+    exec::async_shared_mutex mutex;
+    CHECK(ex::sync_wait(mutex.lock_shared()).has_value());
+    CHECK(mutex.try_lock_shared());
+    CHECK_FALSE(mutex.try_lock());
+    mutex.unlock_shared();
+    CHECK_FALSE(mutex.try_lock());
+    mutex.unlock_shared();
+    CHECK(mutex.try_lock());
+    CHECK_FALSE(mutex.try_lock_shared());
+    mutex.unlock();
+  }
+
+  TEST_CASE(
+    "async_shared_mutex queues readers behind a waiting writer",
+    "[types][async_shared_mutex]") {
+    exec::async_shared_mutex mutex;
+    REQUIRE(mutex.try_lock_shared());
+    std::vector<int> order;
+    auto writer = ex::connect(
+      mutex.lock() | ex::then([&] { order.push_back(0); }), empty_recv::recv0{});
+    auto reader1 = ex::connect(
+      mutex.lock_shared() | ex::then([&] { order.push_back(1); }), empty_recv::recv0{});
+    auto reader2 = ex::connect(
+      mutex.lock_shared() | ex::then([&] { order.push_back(2); }), empty_recv::recv0{});
+    ex::start(writer);
+    ex::start(reader1);
+    ex::start(reader2);
+    // The writer waits for the first reader, and the other readers wait for the writer.
+    CHECK(order.empty());
+    CHECK_FALSE(mutex.try_lock_shared());
+    mutex.unlock_shared();
+    CHECK(order == std::vector{0});
+    // Releasing the writer admits both readers at once.
+    mutex.unlock();
+    CHECK(order == std::vector{0, 1, 2});
+    mutex.unlock_shared();
+    mutex.unlock_shared();
+    CHECK(mutex.try_lock());
+    mutex.unlock();
+  }
+
+  TEST_CASE(
+    "async_shared_mutex admits readers when a waiting writer is cancelled",
+    "[types][async_shared_mutex]") {
+    exec::async_shared_mutex mutex;
+    REQUIRE(mutex.try_lock_shared());
+    ex::inplace_stop_source stop_source;
+    bool writer_stopped = false;
+    bool reader_locked = false;
+    auto writer = ex::connect(
+      ex::__write_env(mutex.lock(), ex::prop{ex::get_stop_token, stop_source.get_token()})
+        | ex::upon_stopped([&] { writer_stopped = true; }),
+      empty_recv::recv0{});
+    auto reader = ex::connect(
+      mutex.lock_shared() | ex::then([&] { reader_locked = true; }), empty_recv::recv0{});
+    ex::start(writer);
+    ex::start(reader);
+    CHECK_FALSE(reader_locked);
+    stop_source.request_stop();
+    CHECK(writer_stopped);
+    CHECK(reader_locked);
+    mutex.unlock_shared();
+    mutex.unlock_shared();
+  }
+
+  TEST_CASE(
+    "async_shared_mutex resumes waiters on their scheduler",
+    "[types][async_shared_mutex]") {
+    exec::static_thread_pool pool{1};
+    exec::async_shared_mutex mutex;
+    REQUIRE(mutex.try_lock());
+    std::thread::id main_id = std::this_thread::get_id();
+    std::thread::id resumed_id;
+    std::thread releaser{[&] {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      mutex.unlock();
+    }};
+    ex::sync_wait(
+      ex::__write_env(mutex.lock_shared(), ex::prop{ex::get_scheduler, pool.get_scheduler()})
+      | ex::then([&] { resumed_id = std::this_thread::get_id(); }));
+    releaser.join();
+    CHECK(resumed_id != main_id);
+    CHECK(resumed_id != releaser.get_id());
+    mutex.unlock_shared();
+  }
+
+  TEST_CASE(
+    "async_shared_mutex excludes writers from readers across threads",
+    "[types][async_shared_mutex]") {
+    exec::static_thread_pool pool{4};
+    exec::async_shared_mutex mutex;
+    exec::async_scope scope;
+    std::atomic<int> readers{0};
+    std::atomic<bool> violated{false};
+    int value = 0;
+    constexpr int num_tasks = 4000;
+    for (int i = 0; i < num_tasks; ++i) {
+      if (i % 8 == 0) {
+        scope.spawn(
+          ex::starts_on(pool.get_scheduler(), mutex.lock()) | ex::then([&] {
+            if (readers.load() != 0) {
+              violated = true;
+            }
+            ++value;
+            mutex.unlock();
+          }));
+      } else {
+        scope.spawn(
+          ex::starts_on(pool.get_scheduler(), mutex.lock_shared()) | ex::then([&] {
+            readers.fetch_add(1);
+            readers.fetch_sub(1);
+            mutex.unlock_shared();
+          }));
+      }
+    }
+    ex::sync_wait(scope.on_empty());
+    CHECK_FALSE(violated.load());
+    CHECK(value == num_tasks / 8);
+  }
+} // namespace
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <exec/bulk_chunked.hpp>
+#include <exec/static_thread_pool.hpp>
+#include <stdexec/execution.hpp>
+
+#include <catch2/catch.hpp>
+#include <test_common/receivers.hpp>
+#include <test_common/type_helpers.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace ex = stdexec;
+
+namespace {
+  TEST_CASE("bulk_chunked returns a sender", "[adaptors][bulk_chunked]") {
+    auto snd = exec::bulk_chunked(ex::just(19), 8, [](int, int, int) { });
+    STATIC_REQUIRE(ex::sender<decltype(snd)>);
+    (void) snd;
+  }
+
+  TEST_CASE("bulk_chunked can be piped", "[adaptors][bulk_chunked]") {
+    ex::sender auto snd = ex::just() | exec::bulk_chunked(42, [](int, int) { });
+    (void) snd;
+  }
+
+  TEST_CASE("bulk_chunked keeps values_type from input sender", "[adaptors][bulk_chunked]") {
+    constexpr int n = 42;
+    check_val_types<ex::__mmake_set<pack<>>>(
+      ex::just() | exec::bulk_chunked(n, [](int, int) noexcept { }));
+    check_val_types<ex::__mmake_set<pack<double>>>(
+      ex::just(4.2) | exec::bulk_chunked(n, [](int, int, double) noexcept { }));
+  }
+
+  TEST_CASE(
+    "bulk_chunked calls the function once for the whole range",
+    "[adaptors][bulk_chunked]") {
+    std::vector<std::pair<int, int>> ranges;
+    auto snd = ex::just(3) | exec::bulk_chunked(10, [&](int begin, int end, int value) {
+                 CHECK(value == 3);
+                 ranges.emplace_back(begin, end);
+               });
+    auto [value] = ex::sync_wait(std::move(snd)).value();
+
+    CHECK(value == 3);
+    CHECK(ranges == std::vector<std::pair<int, int>>{{0, 10}});
+  }
+
+  TEST_CASE(
+    "bulk_chunked does not call the function for an empty range",
+    "[adaptors][bulk_chunked]") {
+    bool called{false};
+    auto snd = ex::just() | exec::bulk_chunked(0, [&](int, int) { called = true; });
+    ex::sync_wait(std::move(snd));
+    CHECK_FALSE(called);
+  }
+
+  TEST_CASE("bulk_chunked can throw, and set_error will be called", "[adaptors][bulk_chunked]") {
+    auto snd = ex::just()
+             | exec::bulk_chunked(8, [](int, int) -> int { throw std::logic_error{"err"}; });
+    auto op = ex::connect(std::move(snd), expect_error_receiver{});
+    ex::start(op);
+  }
+
+  TEST_CASE("bulk_chunked works with static thread pool", "[adaptors][bulk_chunked]") {
+    exec::static_thread_pool pool{4};
+    ex::scheduler auto sch = pool.get_scheduler();
+
+    SECTION("The chunks partition the range") {
+      for (std::size_t n = 0; n < 9; ++n) {
+        std::vector<int> counter(n, 0);
+        std::atomic<std::size_t> num_chunks{0};
+        auto snd = ex::schedule(sch)
+                 | exec::bulk_chunked(n, [&](std::size_t begin, std::size_t end) {
+                     ++num_chunks;
+                     for (std::size_t i = begin; i < end; ++i) {
+                       ++counter[i];
+                     }
+                   });
+        ex::sync_wait(std::move(snd));
+
+        CHECK(std::count(counter.begin(), counter.end(), 1) == static_cast<int>(n));
+        CHECK(num_chunks <= std::min<std::size_t>(n, 4));
+      }
+    }
+
+    SECTION("Fused with an element-wise bulk") {
+      constexpr std::size_t n = 1000;
+      std::vector<int> a(n, 0);
+      std::vector<int> b(n, 0);
+      auto snd = ex::schedule(sch)
+               | exec::bulk_chunked(
+                   n,
+                   [&](std::size_t begin, std::size_t end) {
+                     std::fill(a.begin() + begin, a.begin() + end, 1);
+                   })
+               | ex::bulk(n, [&](std::size_t i) { b[i] = a[n - i - 1] + 1; });
+      ex::sync_wait(std::move(snd));
+
+      CHECK(std::count(b.begin(), b.end(), 2) == static_cast<int>(n));
+    }
+
+    SECTION("With exception") {
+      auto snd = ex::schedule(sch) | exec::bulk_chunked(9, [](int, int) {
+                   throw std::runtime_error("bulk_chunked");
+                 });
+      CHECK_THROWS_AS(ex::sync_wait(std::move(snd)), std::runtime_error);
+    }
+  }
+} // namespace
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <exec/bulk_nd.hpp>
+#include <exec/static_thread_pool.hpp>
+#include <stdexec/execution.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace ex = stdexec;
+
+namespace {
+  TEST_CASE("bulk_nd returns a sender", "[adaptors][bulk_nd]") {
+    auto snd = exec::bulk_nd(
+      ex::just(), std::array<int, 2>{4, 4}, std::array<int, 2>{2, 2}, [](int, int) { });
+    STATIC_REQUIRE(ex::sender<decltype(snd)>);
+    (void) snd;
+  }
+
+  TEST_CASE("bulk_nd visits every index exactly once", "[adaptors][bulk_nd]") {
+    constexpr std::size_t rows = 13;
+    constexpr std::size_t cols = 7;
+    auto order = GENERATE(exec::tile_order::row_major, exec::tile_order::morton);
+
+    std::vector<int> counter(rows * cols, 0);
+    auto snd = ex::just()
+             | exec::bulk_nd(
+                 std::array{rows, cols},
+                 std::array<std::size_t, 2>{4, 3},
+                 [&](std::size_t i, std::size_t j) { ++counter[i * cols + j]; },
+                 order);
+    ex::sync_wait(std::move(snd));
+
+    CHECK(std::count(counter.begin(), counter.end(), 1) == static_cast<int>(rows * cols));
+  }
+
+  TEST_CASE("bulk_nd works with three dimensions", "[adaptors][bulk_nd]") {
+    constexpr std::array<int, 3> extents{5, 6, 3};
+    std::vector<int> counter(5 * 6 * 3, 0);
+    auto snd = ex::just()
+             | exec::bulk_nd(extents, std::array{2, 4, 2}, [&](int i, int j, int k) {
+                 ++counter[(i * 6 + j) * 3 + k];
+               });
+    ex::sync_wait(std::move(snd));
+
+    CHECK(std::count(counter.begin(), counter.end(), 1) == 5 * 6 * 3);
+  }
+
+  TEST_CASE("bulk_nd enumerates tiles along a Morton curve", "[adaptors][bulk_nd]") {
+    // The default bulk runs the tiles in order; record the first index of each tile.
+    std::vector<std::pair<int, int>> origins;
+    auto snd = ex::just()
+             | exec::bulk_nd(std::array{4, 4}, std::array{2, 2}, [&](int i, int j) {
+                 if (i % 2 == 0 && j % 2 == 0) {
+                   origins.emplace_back(i, j);
+                 }
+               });
+    ex::sync_wait(std::move(snd));
+
+    const std::vector<std::pair<int, int>> expected{
+      {0, 0},
+      {0, 2},
+      {2, 0},
+      {2, 2}
+    };
+    CHECK(origins == expected);
+  }
+
+  TEST_CASE("bulk_nd forwards values", "[adaptors][bulk_nd]") {
+    std::atomic<int> sum{0};
+    auto snd = ex::just(2)
+             | exec::bulk_nd(
+                 std::array{3, 3}, std::array{2, 2}, [&](int, int, int value) { sum += value; });
+    auto [value] = ex::sync_wait(std::move(snd)).value();
+
+    CHECK(value == 2);
+    CHECK(sum == 18);
+  }
+
+  TEST_CASE("bulk_nd propagates exceptions", "[adaptors][bulk_nd]") {
+    auto snd = ex::just()
+             | exec::bulk_nd(std::array{3, 3}, std::array{2, 2}, [](int, int) {
+                 throw std::runtime_error("bulk_nd");
+               });
+    CHECK_THROWS_AS(ex::sync_wait(std::move(snd)), std::runtime_error);
+  }
+
+  TEST_CASE("bulk_nd works with static thread pool", "[adaptors][bulk_nd]") {
+    exec::static_thread_pool pool{4};
+    constexpr std::size_t n = 100;
+    std::vector<int> counter(n * n, 0);
+
+    auto snd = ex::schedule(pool.get_scheduler())
+             | exec::bulk_nd(
+                 std::array{n, n},
+                 std::array<std::size_t, 2>{16, 16},
+                 [&](std::size_t i, std::size_t j) { ++counter[i * n + j]; });
+    ex::sync_wait(std::move(snd));
+
+    CHECK(std::count(counter.begin(), counter.end(), 1) == static_cast<int>(n * n));
+  }
+} // namespace
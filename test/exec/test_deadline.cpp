@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <exec/deadline.hpp>
+#include <exec/timed_thread_scheduler.hpp>
+#include <stdexec/execution.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <chrono>
+
+namespace ex = stdexec;
+using namespace std::chrono_literals;
+using clock_type = std::chrono::steady_clock;
+
+namespace {
+  TEST_CASE("with_deadline passes the deadline to the child", "[adaptors][deadline]") {
+    const auto deadline = clock_type::now() + 1h;
+    auto result = ex::sync_wait(exec::with_deadline(ex::read_env(exec::get_deadline), deadline));
+    REQUIRE(result.has_value());
+    CHECK(std::get<0>(*result) == deadline);
+
+    auto piped = ex::sync_wait(ex::read_env(exec::get_deadline) | exec::with_deadline(deadline));
+    REQUIRE(piped.has_value());
+    CHECK(std::get<0>(*piped) == deadline);
+  }
+
+  TEST_CASE("with_deadline keeps the tighter deadline", "[adaptors][deadline]") {
+    const auto early = clock_type::now() + 1h;
+    const auto late = early + 1h;
+    auto inner_earlier = ex::sync_wait(
+      exec::with_deadline(exec::with_deadline(ex::read_env(exec::get_deadline), early), late));
+    REQUIRE(inner_earlier.has_value());
+    CHECK(std::get<0>(*inner_earlier) == early);
+
+    auto outer_earlier = ex::sync_wait(
+      exec::with_deadline(exec::with_deadline(ex::read_env(exec::get_deadline), late), early));
+    REQUIRE(outer_earlier.has_value());
+    CHECK(std::get<0>(*outer_earlier) == early);
+  }
+
+  TEST_CASE("with_timeout measures from the start of the operation", "[adaptors][deadline]") {
+    auto sndr = exec::with_timeout(ex::read_env(exec::get_deadline), 1h);
+    const auto before = clock_type::now();
+    auto result = ex::sync_wait(std::move(sndr));
+    const auto after = clock_type::now();
+    REQUIRE(result.has_value());
+    CHECK(std::get<0>(*result) >= before + 1h);
+    CHECK(std::get<0>(*result) <= after + 1h);
+  }
+
+  TEST_CASE("with_timeout stops the child when the deadline passes", "[adaptors][deadline]") {
+    exec::timed_thread_context context;
+    auto sched = context.get_scheduler();
+    const auto start = clock_type::now();
+    auto result = ex::sync_wait(exec::with_timeout(exec::schedule_after(sched, 1h), sched, 10ms));
+    CHECK_FALSE(result.has_value());
+    CHECK(clock_type::now() - start < 1min);
+  }
+
+  TEST_CASE("with_deadline forwards the result of a timely child", "[adaptors][deadline]") {
+    exec::timed_thread_context context;
+    auto sched = context.get_scheduler();
+    auto result = ex::sync_wait(
+      exec::with_deadline(
+        exec::schedule_after(sched, 1ms) | ex::then([] { return 42; }),
+        sched,
+        clock_type::now() + 1h));
+    REQUIRE(result.has_value());
+    CHECK(std::get<0>(*result) == 42);
+
+    CHECK_THROWS_AS(
+      ex::sync_wait(
+        ex::just() | ex::then([] { throw std::runtime_error{"error"}; })
+        | exec::with_timeout(sched, 1h)),
+      std::runtime_error);
+  }
+
+  TEST_CASE("with_deadline passes stop requests to the child", "[adaptors][deadline]") {
+    exec::timed_thread_context context;
+    auto sched = context.get_scheduler();
+    ex::inplace_stop_source stop_source;
+    stop_source.request_stop();
+    auto result = ex::sync_wait(ex::__write_env(
+      exec::with_timeout(exec::schedule_after(sched, 1h), sched, 1h),
+      ex::prop{ex::get_stop_token, stop_source.get_token()}));
+    CHECK_FALSE(result.has_value());
+  }
+} // namespace
@@ -21,13 +21,31 @@
 // allow user access to some of the necessary system calls.
 #if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 4, 0) && __has_include(<linux/io_uring.h>)
 
+#  define STDEXEC_SYSTEM_CONTEXT_HEADER_ONLY 1
+
 #  include "exec/linux/io_uring_context.hpp"
+#  include "exec/linux/io_uring_system_context.hpp"
+#  include "exec/system_context.hpp"
 #  include "exec/scope.hpp"
 #  include "exec/single_thread_context.hpp"
+#  include "exec/deadline.hpp"
 #  include "exec/finally.hpp"
 #  include "exec/when_any.hpp"
 
 #  include "catch2/catch.hpp"
+#  include "test_common/system_context.hpp"
+
+#  include <arpa/inet.h>
+#  include <fcntl.h>
+#  include <netinet/in.h>
+#  include <sys/mman.h>
+#  include <sys/socket.h>
+#  include <sys/stat.h>
+
+#  include <span>
+#  include <string>
+#  include <thread>
+#  include <vector>
 
 using namespace stdexec;
 using namespace exec;
@@ -339,6 +357,436 @@ namespace {
     }
   }
 
+  TEST_CASE("io_uring_context schedule_after with a deadline", "[types][io_uring][schedulers]") {
+    io_uring_context context;
+    io_uring_scheduler scheduler = context.get_scheduler();
+    jthread io_thread{[&] {
+      context.run_until_stopped();
+    }};
+    {
+      scope_guard guard{[&]() noexcept {
+        context.request_stop();
+      }};
+      // The kernel cancels the operation through its linked timeout.
+      auto start = std::chrono::steady_clock::now();
+      CHECK_FALSE(sync_wait(with_timeout(schedule_after(scheduler, 10s), 20ms)));
+      CHECK(std::chrono::steady_clock::now() - start < 10s);
+
+      bool is_called = false;
+      sync_wait(
+        with_timeout(schedule_after(scheduler, 1ms), 10s) | then([&] { is_called = true; }));
+      CHECK(is_called);
+    }
+  }
+
+  TEST_CASE(
+    "io_uring_context submit_linked runs requests in order",
+    "[types][io_uring][schedulers]") {
+    io_uring_context context;
+    io_uring_scheduler scheduler = context.get_scheduler();
+    jthread io_thread{[&] {
+      context.run_until_stopped();
+    }};
+    {
+      scope_guard guard{[&]() noexcept {
+        context.request_stop();
+      }};
+      safe_file_descriptor fd{::memfd_create("test_io_uring_context", 0)};
+      REQUIRE(fd.native_handle() >= 0);
+      const std::string data = "Hello, io_uring!";
+      std::string buffer(data.size(), '\0');
+      auto result = sync_wait(scheduler.submit_linked(
+        io_uring_write(fd, std::as_bytes(std::span{data}), 0),
+        io_uring_fdatasync(fd),
+        io_uring_read(fd, std::as_writable_bytes(std::span{buffer}), 0)));
+      REQUIRE(result.has_value());
+      CHECK(*result == std::tuple{data.size(), std::size_t{0}, data.size()});
+      CHECK(buffer == data);
+
+      auto single = sync_wait(scheduler.submit(io_uring_fsync(fd)));
+      REQUIRE(single.has_value());
+      CHECK(std::get<0>(*single) == 0);
+    }
+  }
+
+  TEST_CASE("io_uring_context a failed request breaks the chain", "[types][io_uring][schedulers]") {
+    io_uring_context context;
+    io_uring_scheduler scheduler = context.get_scheduler();
+    jthread io_thread{[&] {
+      context.run_until_stopped();
+    }};
+    {
+      scope_guard guard{[&]() noexcept {
+        context.request_stop();
+      }};
+      safe_file_descriptor fd{::memfd_create("test_io_uring_context", 0)};
+      REQUIRE(fd.native_handle() >= 0);
+      const std::string data = "data";
+      std::string buffer(data.size(), '\0');
+      auto buffer_bytes = std::as_writable_bytes(std::span{buffer});
+      CHECK_THROWS_AS(
+        sync_wait(scheduler.submit_linked(
+          io_uring_read(-1, buffer_bytes, 0), io_uring_write(fd, std::as_bytes(std::span{data})))),
+        std::system_error);
+      struct ::stat status{};
+      REQUIRE(::fstat(fd, &status) == 0);
+      CHECK(status.st_size == 0);
+
+      // A hard link runs the rest of the chain anyway.
+      CHECK_THROWS_AS(
+        sync_wait(scheduler.submit_hardlinked(
+          io_uring_read(-1, buffer_bytes, 0), io_uring_write(fd, std::as_bytes(std::span{data})))),
+        std::system_error);
+      REQUIRE(::fstat(fd, &status) == 0);
+      CHECK(status.st_size == static_cast<::off_t>(data.size()));
+    }
+  }
+
+  TEST_CASE("io_uring_context stops a pending chain", "[types][io_uring][schedulers]") {
+    io_uring_context context;
+    io_uring_scheduler scheduler = context.get_scheduler();
+    jthread io_thread{[&] {
+      context.run_until_stopped();
+    }};
+    {
+      scope_guard guard{[&]() noexcept {
+        context.request_stop();
+      }};
+      int pipe_fds[2];
+      REQUIRE(::pipe(pipe_fds) == 0);
+      safe_file_descriptor read_end{pipe_fds[0]};
+      safe_file_descriptor write_end{pipe_fds[1]};
+      char buffer[8];
+      bool is_stopped = false;
+      sync_wait(when_any(
+        scheduler.submit_linked(
+          io_uring_read(read_end, std::as_writable_bytes(std::span{buffer})),
+          io_uring_fsync(write_end))
+          | then([](std::size_t, std::size_t) { })
+          | upon_stopped([&] { is_stopped = true; }),
+        schedule_after(scheduler, 10ms)));
+      CHECK(is_stopped);
+    }
+  }
+
+#  ifdef STDEXEC_HAS_IORING_OP_SEND
+  TEST_CASE("io_uring_context sends on a socket", "[types][io_uring][schedulers]") {
+    io_uring_context context;
+    io_uring_scheduler scheduler = context.get_scheduler();
+    jthread io_thread{[&] {
+      context.run_until_stopped();
+    }};
+    scope_guard guard{[&]() noexcept {
+      context.request_stop();
+    }};
+    int fds[2];
+    REQUIRE(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0);
+    safe_file_descriptor sender{fds[0]};
+    safe_file_descriptor receiver{fds[1]};
+
+    // Unix domain sockets do not support zero-copy sends.
+    const std::string hello = "hello";
+    auto sent = sync_wait(scheduler.async_send(sender, std::as_bytes(std::span{hello})));
+    REQUIRE(sent);
+    CHECK(std::get<0>(*sent) == hello.size());
+
+    std::string world = "world";
+    std::string bang = "!";
+    ::iovec iov[2]{{world.data(), world.size()}, {bang.data(), bang.size()}};
+    ::msghdr msg{};
+    msg.msg_iov = iov;
+    msg.msg_iovlen = 2;
+    sent = sync_wait(scheduler.async_sendmsg(sender, msg));
+    REQUIRE(sent);
+    CHECK(std::get<0>(*sent) == world.size() + bang.size());
+
+    char buffer[16]{};
+    std::size_t n_received = 0;
+    while (n_received < 11) {
+      auto n = ::recv(receiver, buffer + n_received, sizeof(buffer) - n_received, 0);
+      REQUIRE(n > 0);
+      n_received += static_cast<std::size_t>(n);
+    }
+    CHECK(std::string(buffer, n_received) == "helloworld!");
+  }
+
+  TEST_CASE("io_uring_context sends on a TCP socket", "[types][io_uring][schedulers]") {
+    io_uring_context context;
+    io_uring_scheduler scheduler = context.get_scheduler();
+    jthread io_thread{[&] {
+      context.run_until_stopped();
+    }};
+    scope_guard guard{[&]() noexcept {
+      context.request_stop();
+    }};
+    safe_file_descriptor listener{::socket(AF_INET, SOCK_STREAM, 0)};
+    REQUIRE(listener);
+    ::sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    ::socklen_t length = sizeof(address);
+    REQUIRE(::bind(listener, reinterpret_cast<::sockaddr*>(&address), length) == 0);
+    REQUIRE(::listen(listener, 1) == 0);
+    REQUIRE(::getsockname(listener, reinterpret_cast<::sockaddr*>(&address), &length) == 0);
+    safe_file_descriptor sender{::socket(AF_INET, SOCK_STREAM, 0)};
+    REQUIRE(::connect(sender, reinterpret_cast<::sockaddr*>(&address), length) == 0);
+    safe_file_descriptor receiver{::accept(listener, nullptr, nullptr)};
+    REQUIRE(receiver);
+
+    std::vector<char> payload(64 * 1024);
+    for (std::size_t i = 0; i < payload.size(); ++i) {
+      payload[i] = static_cast<char>(i);
+    }
+    std::vector<char> received(payload.size());
+    std::thread reader{[&] {
+      std::size_t n_received = 0;
+      while (n_received < received.size()) {
+        auto n = ::recv(receiver, received.data() + n_received, received.size() - n_received, 0);
+        if (n <= 0) {
+          break;
+        }
+        n_received += static_cast<std::size_t>(n);
+      }
+    }};
+    std::size_t n_sent = 0;
+    while (n_sent < payload.size()) {
+      auto sent = sync_wait(
+        scheduler.async_send(sender, std::as_bytes(std::span{payload}).subspan(n_sent)));
+      REQUIRE(sent);
+      REQUIRE(std::get<0>(*sent) > 0);
+      n_sent += std::get<0>(*sent);
+    }
+    reader.join();
+    CHECK(received == payload);
+  }
+
+  TEST_CASE("io_uring_context connects and accepts sockets", "[types][io_uring][schedulers]") {
+    io_uring_context context;
+    io_uring_scheduler scheduler = context.get_scheduler();
+    jthread io_thread{[&] {
+      context.run_until_stopped();
+    }};
+    scope_guard guard{[&]() noexcept {
+      context.request_stop();
+    }};
+    safe_file_descriptor listener{::socket(AF_INET, SOCK_STREAM, 0)};
+    REQUIRE(listener);
+    ::sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    ::socklen_t length = sizeof(address);
+    REQUIRE(::bind(listener, reinterpret_cast<::sockaddr*>(&address), length) == 0);
+    REQUIRE(::listen(listener, 1) == 0);
+    REQUIRE(::getsockname(listener, reinterpret_cast<::sockaddr*>(&address), &length) == 0);
+
+    safe_file_descriptor client{::socket(AF_INET, SOCK_STREAM, 0)};
+    auto accepted = sync_wait(when_all(
+      scheduler.async_accept(listener),
+      scheduler.async_connect(client, reinterpret_cast<::sockaddr*>(&address), length)));
+    REQUIRE(accepted);
+    const int server = std::get<0>(*accepted);
+    REQUIRE(server >= 0);
+
+    const std::string ping = "ping";
+    char buffer[16]{};
+    auto received = sync_wait(when_all(
+      scheduler.async_send(client, std::as_bytes(std::span{ping})),
+      scheduler.async_recv(server, std::as_writable_bytes(std::span{buffer}))));
+    REQUIRE(received);
+    CHECK(std::string(buffer, std::get<1>(*received)) == ping);
+
+#  ifdef STDEXEC_HAS_IORING_OP_SHUTDOWN
+    // The peer sees the end of the stream once the writing side is shut down.
+    REQUIRE(sync_wait(scheduler.async_shutdown(client, SHUT_WR)));
+    auto end_of_stream =
+      sync_wait(scheduler.async_recv(server, std::as_writable_bytes(std::span{buffer})));
+    REQUIRE(end_of_stream);
+    CHECK(std::get<0>(*end_of_stream) == 0);
+#  endif
+
+    CHECK(sync_wait(scheduler.async_close(server)));
+    CHECK_THROWS_AS(sync_wait(scheduler.async_close(server)), std::system_error);
+  }
+
+  TEST_CASE(
+    "io_uring_context closes a descriptor although a stop is requested",
+    "[types][io_uring][schedulers]") {
+    io_uring_context context;
+    io_uring_scheduler scheduler = context.get_scheduler();
+    jthread io_thread{[&] {
+      context.run_until_stopped();
+    }};
+    scope_guard guard{[&]() noexcept {
+      context.request_stop();
+    }};
+    int fds[2];
+    REQUIRE(::pipe2(fds, O_CLOEXEC) == 0);
+    safe_file_descriptor writer{fds[1]};
+    inplace_stop_source stop_source;
+    stop_source.request_stop();
+    // The close is not interrupted, so it reports that the descriptor is gone.
+    CHECK(sync_wait(
+      __write_env(scheduler.async_close(fds[0]), prop{get_stop_token, stop_source.get_token()})));
+    CHECK(::fcntl(fds[0], F_GETFD) == -1);
+  }
+
+  TEST_CASE("io_uring_context stops a pending accept", "[types][io_uring][schedulers]") {
+    io_uring_context context;
+    io_uring_scheduler scheduler = context.get_scheduler();
+    jthread io_thread{[&] {
+      context.run_until_stopped();
+    }};
+    scope_guard guard{[&]() noexcept {
+      context.request_stop();
+    }};
+    safe_file_descriptor listener{::socket(AF_INET, SOCK_STREAM, 0)};
+    REQUIRE(listener);
+    ::sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    REQUIRE(::bind(listener, reinterpret_cast<::sockaddr*>(&address), sizeof(address)) == 0);
+    REQUIRE(::listen(listener, 1) == 0);
+    bool is_stopped = false;
+    sync_wait(when_any(
+      scheduler.async_accept(listener) | then([](int fd) { ::close(fd); })
+        | upon_stopped([&] { is_stopped = true; }),
+      schedule_after(scheduler, 10ms)));
+    CHECK(is_stopped);
+  }
+
+  TEST_CASE("io_uring_context stops a pending send", "[types][io_uring][schedulers]") {
+    io_uring_context context;
+    io_uring_scheduler scheduler = context.get_scheduler();
+    jthread io_thread{[&] {
+      context.run_until_stopped();
+    }};
+    scope_guard guard{[&]() noexcept {
+      context.request_stop();
+    }};
+    int fds[2];
+    REQUIRE(::socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, fds) == 0);
+    safe_file_descriptor sender{fds[0]};
+    safe_file_descriptor receiver{fds[1]};
+    // Fill the socket buffer so that the next send has to wait.
+    char buffer[4096]{};
+    while (::send(sender, buffer, sizeof(buffer), 0) > 0) {
+    }
+    REQUIRE(::fcntl(sender, F_SETFL, 0) == 0);
+    bool is_stopped = false;
+    sync_wait(when_any(
+      scheduler.async_send(sender, std::as_bytes(std::span{buffer}))
+        | then([](std::size_t) { })
+        | upon_stopped([&] { is_stopped = true; }),
+      schedule_after(scheduler, 10ms)));
+    CHECK(is_stopped);
+  }
+#  endif
+
+#  ifdef STDEXEC_HAS_IORING_OP_SPLICE
+  TEST_CASE("io_uring_context splices and tees pipes", "[types][io_uring][schedulers]") {
+    io_uring_context context;
+    io_uring_scheduler scheduler = context.get_scheduler();
+    jthread io_thread{[&] {
+      context.run_until_stopped();
+    }};
+    scope_guard guard{[&]() noexcept {
+      context.request_stop();
+    }};
+    safe_file_descriptor file{::memfd_create("splice", MFD_CLOEXEC)};
+    REQUIRE(file);
+    const std::string content = "hello, splice";
+    REQUIRE(::write(file, content.data(), content.size()) == ::ssize_t(content.size()));
+    int fds[2];
+    REQUIRE(::pipe(fds) == 0);
+    safe_file_descriptor read_end{fds[0]};
+    safe_file_descriptor write_end{fds[1]};
+    REQUIRE(::pipe(fds) == 0);
+    safe_file_descriptor copy_read_end{fds[0]};
+    safe_file_descriptor copy_write_end{fds[1]};
+
+    auto spliced = sync_wait(scheduler.async_splice(file, write_end, content.size(), 0));
+    REQUIRE(spliced);
+    CHECK(std::get<0>(*spliced) == content.size());
+    auto teed = sync_wait(scheduler.async_tee(read_end, copy_write_end, content.size()));
+    REQUIRE(teed);
+    CHECK(std::get<0>(*teed) == content.size());
+
+    char buffer[32]{};
+    CHECK(std::string(buffer, ::read(read_end, buffer, sizeof(buffer))) == content);
+    CHECK(std::string(buffer, ::read(copy_read_end, buffer, sizeof(buffer))) == content);
+  }
+
+  TEST_CASE("io_uring_context transfers a file to a socket", "[types][io_uring][schedulers]") {
+    io_uring_context context;
+    io_uring_scheduler scheduler = context.get_scheduler();
+    jthread io_thread{[&] {
+      context.run_until_stopped();
+    }};
+    scope_guard guard{[&]() noexcept {
+      context.request_stop();
+    }};
+    safe_file_descriptor file{::memfd_create("transfer", MFD_CLOEXEC)};
+    REQUIRE(file);
+    std::vector<char> content(300 * 1024);
+    for (std::size_t i = 0; i < content.size(); ++i) {
+      content[i] = static_cast<char>(i * 7);
+    }
+    REQUIRE(::write(file, content.data(), content.size()) == ::ssize_t(content.size()));
+    int fds[2];
+    REQUIRE(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0);
+    safe_file_descriptor sender{fds[0]};
+    safe_file_descriptor receiver{fds[1]};
+
+    std::vector<char> received;
+    std::thread reader{[&] {
+      char buffer[4096];
+      while (true) {
+        auto n = ::recv(receiver, buffer, sizeof(buffer), 0);
+        if (n <= 0) {
+          break;
+        }
+        received.insert(received.end(), buffer, buffer + n);
+      }
+    }};
+    // Asks for more than the file holds, from an offset into it.
+    const std::size_t offset = 1000;
+    auto sent = sync_wait(scheduler.async_transfer_file(file, sender, offset, content.size()));
+    ::shutdown(sender, SHUT_WR);
+    reader.join();
+    REQUIRE(sent);
+    CHECK(std::get<0>(*sent) == content.size() - offset);
+    CHECK(std::equal(received.begin(), received.end(), content.begin() + offset, content.end()));
+  }
+  TEST_CASE("io_uring_context stops a pending file transfer", "[types][io_uring][schedulers]") {
+    io_uring_context context;
+    io_uring_scheduler scheduler = context.get_scheduler();
+    jthread io_thread{[&] {
+      context.run_until_stopped();
+    }};
+    scope_guard guard{[&]() noexcept {
+      context.request_stop();
+    }};
+    safe_file_descriptor file{::memfd_create("transfer", MFD_CLOEXEC)};
+    REQUIRE(file);
+    REQUIRE(::ftruncate(file, 1 << 20) == 0);
+    int fds[2];
+    REQUIRE(::socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, fds) == 0);
+    safe_file_descriptor sender{fds[0]};
+    safe_file_descriptor receiver{fds[1]};
+    // Nobody reads from the socket, so the transfer stalls once its buffer is full.
+    char buffer[4096]{};
+    while (::send(sender, buffer, sizeof(buffer), 0) > 0) {
+    }
+    REQUIRE(::fcntl(sender, F_SETFL, 0) == 0);
+    bool is_stopped = false;
+    sync_wait(when_any(
+      scheduler.async_transfer_file(file, sender, 0, 1 << 20) | then([](std::size_t) { })
+        | upon_stopped([&] { is_stopped = true; }),
+      schedule_after(scheduler, 10ms)));
+    CHECK(is_stopped);
+  }
+#  endif
+
   TEST_CASE("io_uring_context - reuse context after being used", "[types][io_uring][schedulers]") {
     io_uring_context context;
     io_uring_scheduler scheduler = context.get_scheduler();
@@ -348,6 +796,31 @@ namespace {
     CHECK(sync_wait(exec::when_any(schedule(scheduler), context.run())));
     CHECK(!sync_wait(exec::when_any(schedule(scheduler), context.run())));
   }
+  TEST_CASE(
+    "io_uring_system_backend - timers of the system scheduler",
+    "[types][io_uring][schedulers][system_scheduler]") {
+    using namespace exec::system_context_replaceability;
+    auto* scr = query_system_context<__system_context_replaceability_v3>();
+    REQUIRE(scr != nullptr);
+
+    io_uring_system_backend backend;
+    system_backend_guard guard;
+    scr->__set_system_scheduler(&backend);
+    exec::system_scheduler sched = get_system_scheduler();
+
+    std::thread::id this_id = std::this_thread::get_id();
+    std::thread::id pool_id{};
+    const auto start = now(sched);
+    sync_wait(schedule_after(sched, 10ms) | then([&] { pool_id = std::this_thread::get_id(); }));
+    CHECK(now(sched) - start >= 10ms);
+    CHECK(pool_id != std::thread::id{});
+    CHECK(pool_id != this_id);
+
+    CHECK_FALSE(sync_wait(with_timeout(schedule_after(sched, 1h), sched, 10ms)));
+
+    // The ring also runs I/O.
+    CHECK(sync_wait(schedule(backend.get_io_scheduler())));
+  }
 } // namespace
 
 #endif
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <exec/async_scope.hpp>
+#include <exec/op_state_allocator.hpp>
+#include <exec/static_thread_pool.hpp>
+#include <stdexec/execution.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace ex = stdexec;
+
+namespace {
+  TEST_CASE("op_state_allocator is an allocator", "[types][op_state_allocator]") {
+    using alloc_t = exec::op_state_allocator<int>;
+    using traits = std::allocator_traits<alloc_t>;
+    STATIC_REQUIRE(std::same_as<traits::value_type, int>);
+    STATIC_REQUIRE(
+      std::same_as<traits::rebind_alloc<double>, exec::op_state_allocator<double>>);
+    CHECK(alloc_t{} == exec::op_state_allocator<double>{});
+  }
+
+  TEST_CASE(
+    "op_state_allocator returns aligned, usable memory of every size",
+    "[types][op_state_allocator]") {
+    exec::op_state_allocator<std::byte> alloc;
+    std::vector<std::pair<std::byte*, std::size_t>> blocks;
+    for (std::size_t size = 1; size <= 10000; size = size * 3 / 2 + 1) {
+      std::byte* p = alloc.allocate(size);
+      CHECK(reinterpret_cast<std::uintptr_t>(p) % 16 == 0);
+      std::memset(p, static_cast<int>(size & 0xff), size);
+      blocks.emplace_back(p, size);
+    }
+    for (auto [p, size]: blocks) {
+      CHECK(p[size - 1] == static_cast<std::byte>(size & 0xff));
+      alloc.deallocate(p, size);
+    }
+
+    struct alignas(64) over_aligned {
+      char c;
+    };
+    exec::op_state_allocator<over_aligned> over;
+    over_aligned* p = over.allocate(3);
+    CHECK(reinterpret_cast<std::uintptr_t>(p) % 64 == 0);
+    over.deallocate(p, 3);
+  }
+
+  TEST_CASE("op_state_allocator reuses freed blocks", "[types][op_state_allocator]") {
+    exec::op_state_allocator<std::array<char, 100>> alloc;
+    auto* p = alloc.allocate(1);
+    alloc.deallocate(p, 1);
+    auto* q = alloc.allocate(1);
+    CHECK(p == q);
+    alloc.deallocate(q, 1);
+  }
+
+  TEST_CASE(
+    "op_state_allocator reclaims blocks freed on other threads",
+    "[types][op_state_allocator]") {
+    constexpr int num_blocks = 1000;
+    exec::op_state_allocator<std::array<char, 48>> alloc;
+    std::vector<std::array<char, 48>*> blocks;
+    for (int i = 0; i < num_blocks; ++i) {
+      blocks.push_back(alloc.allocate(1));
+    }
+    std::thread{[&] {
+      for (auto* p: blocks) {
+        alloc.deallocate(p, 1);
+      }
+    }}.join();
+
+    // The blocks freed remotely are handed back to this thread rather than carved anew.
+    std::vector<std::array<char, 48>*> reused;
+    for (int i = 0; i < num_blocks; ++i) {
+      reused.push_back(alloc.allocate(1));
+    }
+    std::sort(blocks.begin(), blocks.end());
+    std::sort(reused.begin(), reused.end());
+    CHECK(blocks == reused);
+    for (auto* p: reused) {
+      alloc.deallocate(p, 1);
+    }
+  }
+
+  TEST_CASE(
+    "op_state_allocator can allocate the operations of async_scope::spawn",
+    "[types][op_state_allocator]") {
+    constexpr int num_tasks = 10'000;
+    exec::static_thread_pool pool{2};
+    exec::async_scope scope;
+    std::atomic<int> count{0};
+    auto env = ex::prop{ex::get_allocator, exec::op_state_allocator<>{}};
+    for (int i = 0; i < num_tasks; ++i) {
+      scope.spawn(ex::schedule(pool.get_scheduler()) | ex::then([&] { ++count; }), env);
+    }
+    ex::sync_wait(scope.on_empty());
+    CHECK(count.load() == num_tasks);
+  }
+
+  TEST_CASE(
+    "op_state_allocator survives threads that exit with blocks in flight",
+    "[types][op_state_allocator]") {
+    exec::op_state_allocator<std::array<char, 200>> alloc;
+    std::vector<std::array<char, 200>*> blocks;
+    for (int t = 0; t < 8; ++t) {
+      std::thread{[&] {
+        for (int i = 0; i < 100; ++i) {
+          blocks.push_back(alloc.allocate(1));
+        }
+      }}.join();
+    }
+    for (auto* p: blocks) {
+      alloc.deallocate(p, 1);
+    }
+  }
+} // namespace
@@ -28,6 +28,8 @@
 #include <test_common/senders.hpp>
 #include <test_common/type_helpers.hpp>
 #include <iostream>
+#include <algorithm>
+#include <vector>
 
 #include <catch2/catch.hpp>
 #include <type_traits>
@@ -131,4 +133,85 @@ namespace {
     stdexec::sync_wait(std::move(snd));
     REQUIRE(called);
   }
+
+  TEST_CASE("repeat_n of bulk keeps the static_thread_pool agents resident", "[adaptors][repeat_n]") {
+    exec::static_thread_pool pool{4};
+    constexpr std::size_t n = 100;
+    constexpr std::size_t iterations = 50;
+
+    SECTION("Eager customization") {
+      // Ping-pong between two buffers: every stage reads the neighbours written by the previous one.
+      std::vector<std::size_t> a(n, 0);
+      std::vector<std::size_t> b(n, 0);
+      sender auto snd =
+        exec::repeat_n(
+          ex::schedule(pool.get_scheduler())
+            | ex::bulk(n, [&](std::size_t i) { b[i] = a[(i + 1) % n] + 1; })
+            | ex::bulk(n, [&](std::size_t i) { a[i] = b[(n + i - 1) % n]; }),
+          iterations);
+      // The pool replaces the generic `repeat_n` with its own sender.
+      STATIC_REQUIRE_FALSE(ex::sender_expr_for<decltype(snd), exec::repeat_n_t>);
+      stdexec::sync_wait(std::move(snd));
+      CHECK(std::count(a.begin(), a.end(), iterations) == n);
+    }
+
+    SECTION("Gives the same results as re-running the bulk") {
+      // The first stage reads what the second stage wrote in the previous iteration.
+      auto run = [&](auto predecessor) {
+        std::vector<std::size_t> a(n, 1);
+        std::vector<std::size_t> b(n, 0);
+        stdexec::sync_wait(exec::repeat_n(
+          std::move(predecessor)
+            | ex::bulk(n, [&](std::size_t i) { b[i] = a[i] + a[(i + 1) % n]; })
+            | ex::bulk(n, [&](std::size_t i) { a[i] = b[(n + i - 1) % n] % 1'000'003; }),
+          iterations));
+        return a;
+      };
+      const auto resident = run(ex::schedule(pool.get_scheduler()));
+      const auto repeated = run(ex::schedule(pool.get_scheduler()) | ex::then([] { }));
+      CHECK(resident == repeated);
+    }
+
+    SECTION("Runs the predecessor once per iteration") {
+      std::atomic<std::size_t> predecessor{0};
+      std::atomic<std::size_t> body{0};
+      sender auto snd = exec::repeat_n(
+        ex::schedule(pool.get_scheduler()) | ex::then([&] { ++predecessor; })
+          | ex::bulk(4, [&](std::size_t) { ++body; }),
+        iterations);
+      STATIC_REQUIRE(ex::sender_expr_for<decltype(snd), exec::repeat_n_t>);
+      stdexec::sync_wait(std::move(snd));
+      CHECK(predecessor == iterations);
+      CHECK(body == 4 * iterations);
+    }
+
+    SECTION("A bulk that does not directly follow schedule falls back to repeating it") {
+      std::vector<std::size_t> counter(n, 0);
+      sender auto snd = exec::on(
+        pool.get_scheduler(),
+        ex::just() | ex::bulk(n, [&](std::size_t i) { ++counter[i]; }) | exec::repeat_n(iterations));
+      stdexec::sync_wait(std::move(snd));
+      CHECK(std::count(counter.begin(), counter.end(), iterations) == n);
+    }
+
+    SECTION("With zero repetitions") {
+      bool called{false};
+      sender auto snd = exec::repeat_n(
+        ex::schedule(pool.get_scheduler()) | ex::bulk(n, [&](std::size_t) { called = true; }), 0);
+      stdexec::sync_wait(std::move(snd));
+      CHECK_FALSE(called);
+    }
+
+    SECTION("With exception") {
+      std::atomic<int> count{0};
+      sender auto snd = exec::repeat_n(
+        ex::schedule(pool.get_scheduler()) | ex::bulk(n, [&](std::size_t) {
+          ++count;
+          throw std::runtime_error("bulk");
+        }),
+        iterations);
+      CHECK_THROWS_AS(stdexec::sync_wait(std::move(snd)), std::runtime_error);
+      CHECK(count < static_cast<int>(n * iterations));
+    }
+  }
 } // namespace
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <exec/async_scope.hpp>
+#include <exec/inline_scheduler.hpp>
+#include <exec/serial_executor.hpp>
+#include <exec/static_thread_pool.hpp>
+#include <stdexec/execution.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace ex = stdexec;
+
+namespace {
+  TEST_CASE("serial_executor provides a scheduler", "[types][serial_executor]") {
+    exec::static_thread_pool pool{2};
+    exec::serial_executor serial{pool.get_scheduler()};
+    auto sch = serial.get_scheduler();
+    STATIC_REQUIRE(ex::scheduler<decltype(sch)>);
+    CHECK(sch == serial.get_scheduler());
+    CHECK(ex::get_completion_scheduler<ex::set_value_t>(ex::get_env(ex::schedule(sch))) == sch);
+  }
+
+  TEST_CASE("serial_executor runs work on the underlying scheduler", "[types][serial_executor]") {
+    exec::static_thread_pool pool{2};
+    exec::serial_executor serial{pool.get_scheduler()};
+    auto [id] = ex::sync_wait(ex::schedule(serial.get_scheduler()) | ex::then([] {
+                              return std::this_thread::get_id();
+                            }))
+                  .value();
+    CHECK(id != std::this_thread::get_id());
+  }
+
+  TEST_CASE("serial_executor runs work one item at a time in order", "[types][serial_executor]") {
+    constexpr int num_producers = 4;
+    constexpr int num_tasks = 2000;
+    exec::static_thread_pool pool{4};
+    exec::serial_executor serial{pool.get_scheduler(), 16};
+    auto sch = serial.get_scheduler();
+
+    std::atomic<int> concurrent{0};
+    bool overlapped = false;
+    std::vector<std::vector<int>> seen(num_producers);
+    {
+      exec::async_scope scope;
+      std::vector<std::thread> producers;
+      for (int p = 0; p < num_producers; ++p) {
+        producers.emplace_back([&, p] {
+          for (int i = 0; i < num_tasks; ++i) {
+            scope.spawn(ex::schedule(sch) | ex::then([&, p, i] {
+                          overlapped |= concurrent.fetch_add(1) != 0;
+                          seen[p].push_back(i);
+                          concurrent.fetch_sub(1);
+                        }));
+          }
+        });
+      }
+      for (auto& t: producers) {
+        t.join();
+      }
+      ex::sync_wait(scope.on_empty());
+    }
+
+    CHECK_FALSE(overlapped);
+    for (auto& values: seen) {
+      REQUIRE(values.size() == num_tasks);
+      for (int i = 0; i < num_tasks; ++i) {
+        CHECK(values[i] == i);
+      }
+    }
+  }
+
+  TEST_CASE(
+    "serial_executor completes with set_stopped if stop was requested",
+    "[types][serial_executor]") {
+    exec::static_thread_pool pool{1};
+    exec::serial_executor serial{pool.get_scheduler()};
+    ex::inplace_stop_source stop;
+    stop.request_stop();
+    auto snd = stdexec::__write_env(
+      ex::schedule(serial.get_scheduler()), ex::prop{ex::get_stop_token, stop.get_token()});
+    CHECK_FALSE(ex::sync_wait(std::move(snd)).has_value());
+  }
+
+  TEST_CASE("serial_executor works on an inline scheduler", "[types][serial_executor]") {
+    exec::serial_executor serial{exec::inline_scheduler{}, 4};
+    int count = 0;
+    for (int i = 0; i < 10; ++i) {
+      ex::sync_wait(ex::schedule(serial.get_scheduler()) | ex::then([&] { ++count; }));
+    }
+    CHECK(count == 10);
+  }
+} // namespace
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <exec/sharded_scope.hpp>
+#include <exec/static_thread_pool.hpp>
+#include <stdexec/execution.hpp>
+
+#include <catch2/catch.hpp>
+
+#include "test_common/allocators.hpp"
+#include "test_common/receivers.hpp"
+#include "test_common/schedulers.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace ex = stdexec;
+
+namespace {
+  TEST_CASE("sharded_scope nest runs the work", "[types][sharded_scope]") {
+    exec::sharded_scope scope;
+    auto [v] = ex::sync_wait(scope.nest(ex::just(42))).value();
+    CHECK(v == 42);
+    scope.close();
+    ex::sync_wait(scope.on_empty());
+  }
+
+  TEST_CASE("sharded_scope spawn runs the work", "[types][sharded_scope]") {
+    impulse_scheduler sch;
+    exec::sharded_scope scope;
+    bool executed = false;
+    scope.spawn(ex::starts_on(sch, ex::just() | ex::then([&] { executed = true; })));
+    CHECK_FALSE(executed);
+    sch.start_next();
+    CHECK(executed);
+    scope.close();
+    ex::sync_wait(scope.on_empty());
+  }
+
+  TEST_CASE("sharded_scope on_empty waits for close", "[types][sharded_scope]") {
+    exec::sharded_scope scope;
+    bool empty = false;
+    auto op = ex::connect(scope.on_empty() | ex::then([&] { empty = true; }), empty_recv::recv0{});
+    ex::start(op);
+    // The scope has no work, but it is still open.
+    CHECK_FALSE(empty);
+    scope.close();
+    CHECK(empty);
+  }
+
+  TEST_CASE("sharded_scope on_empty waits for nested work", "[types][sharded_scope]") {
+    impulse_scheduler sch;
+    exec::sharded_scope scope{4};
+    bool empty = false;
+    scope.spawn(ex::starts_on(sch, ex::just()));
+    scope.spawn(ex::starts_on(sch, ex::just()));
+    auto op = ex::connect(scope.on_empty() | ex::then([&] { empty = true; }), empty_recv::recv0{});
+    ex::start(op);
+    scope.close();
+    CHECK_FALSE(empty);
+    sch.start_next();
+    CHECK_FALSE(empty);
+    sch.start_next();
+    CHECK(empty);
+  }
+
+  TEST_CASE("sharded_scope rejects work after close", "[types][sharded_scope]") {
+    exec::sharded_scope scope;
+    scope.close();
+    bool executed = false;
+    auto result = ex::sync_wait(scope.nest(ex::just() | ex::then([&] { executed = true; })));
+    CHECK_FALSE(result.has_value());
+    CHECK_FALSE(executed);
+    scope.spawn(ex::just() | ex::then([&] { executed = true; }));
+    CHECK_FALSE(executed);
+    ex::sync_wait(scope.on_empty());
+  }
+
+  TEST_CASE("sharded_scope request_stop stops nested work", "[types][sharded_scope]") {
+    impulse_scheduler sch;
+    exec::sharded_scope scope;
+    bool stopped = false;
+    scope.spawn(
+      ex::starts_on(sch, ex::just()) | ex::let_stopped([&] {
+        stopped = true;
+        return ex::just();
+      }));
+    scope.request_stop();
+    CHECK(scope.get_stop_token().stop_requested());
+    sch.start_next();
+    CHECK(stopped);
+    ex::sync_wait(scope.on_empty());
+  }
+
+  TEST_CASE(
+    "sharded_scope counts work that completes on another thread",
+    "[types][sharded_scope]") {
+    exec::static_thread_pool pool{2};
+    exec::sharded_scope scope{2};
+    std::atomic<int> count{0};
+    constexpr int num_threads = 4;
+    constexpr int num_tasks = 2000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+      threads.emplace_back([&] {
+        for (int i = 0; i < num_tasks; ++i) {
+          scope.spawn(ex::starts_on(pool.get_scheduler(), ex::just() | ex::then([&] {
+                                      count.fetch_add(1, std::memory_order_relaxed);
+                                    })));
+        }
+      });
+    }
+    for (auto& thread: threads) {
+      thread.join();
+    }
+    scope.close();
+    ex::sync_wait(scope.on_empty());
+    CHECK(count.load() == num_threads * num_tasks);
+  }
+
+  TEST_CASE("sharded_scope closes while work completes", "[types][sharded_scope]") {
+    exec::static_thread_pool pool{2};
+    for (int round = 0; round < 50; ++round) {
+      exec::sharded_scope scope{8};
+      std::atomic<int> started{0};
+      std::atomic<int> finished{0};
+      std::thread spawner{[&] {
+        for (int i = 0; i < 200; ++i) {
+          scope.spawn(ex::starts_on(pool.get_scheduler(), ex::just() | ex::then([&] {
+                                      finished.fetch_add(1, std::memory_order_relaxed);
+                                    })));
+          started.fetch_add(1, std::memory_order_relaxed);
+        }
+      }};
+      while (started.load(std::memory_order_relaxed) < 100) {
+        std::this_thread::yield();
+      }
+      scope.close();
+      ex::sync_wait(scope.on_empty());
+      // Everything that was admitted has completed.
+      const int admitted = finished.load();
+      spawner.join();
+      CHECK(finished.load() == admitted);
+    }
+  }
+
+  TEST_CASE("sharded_scope spawn uses the allocator of the environment", "[types][sharded_scope]") {
+    allocation_counts counts;
+    exec::sharded_scope scope;
+    scope.spawn(ex::just(), ex::prop{ex::get_allocator, counting_allocator<std::byte>{counts}});
+    CHECK(counts.allocated == 1);
+    CHECK(counts.alive == 0);
+    scope.close();
+    ex::sync_wait(scope.on_empty());
+  }
+} // namespace
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <exec/inline_scheduler.hpp>
+#include <exec/sort.hpp>
+#include <exec/static_thread_pool.hpp>
+#include <stdexec/execution.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace ex = stdexec;
+
+namespace {
+  auto random_keys(std::size_t n, int max) -> std::vector<int> {
+    std::mt19937 rng{42};
+    std::uniform_int_distribution<int> dist{0, max};
+    std::vector<int> keys(n);
+    std::generate(keys.begin(), keys.end(), [&] { return dist(rng); });
+    return keys;
+  }
+
+  TEST_CASE("exec::sort sorts a range", "[algorithms][sort]") {
+    exec::static_thread_pool pool{4};
+    const std::size_t n = GENERATE(0u, 1u, 100u, 200'000u, 1'000'003u);
+    const int max = GENERATE(3, 1'000'000);
+    auto keys = random_keys(n, max);
+    auto expected = keys;
+    std::sort(expected.begin(), expected.end());
+
+    ex::sync_wait(exec::sort(pool.get_scheduler(), keys));
+
+    CHECK(keys == expected);
+  }
+
+  TEST_CASE("exec::sort sorts a range with few distinct keys", "[algorithms][sort]") {
+    exec::static_thread_pool pool{4};
+    // Every key is equal to a splitter, so all of them end up in buckets of equal keys.
+    const int max = GENERATE(0, 1, 7);
+    auto keys = random_keys(1'000'003, max);
+    std::vector<std::pair<int, std::size_t>> items;
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+      items.emplace_back(keys[i], i);
+    }
+    auto by_key = [](auto const & a, auto const & b) { return a.first < b.first; };
+
+    SECTION("sort") {
+      auto expected = keys;
+      std::sort(expected.begin(), expected.end());
+      ex::sync_wait(exec::sort(pool.get_scheduler(), keys));
+      CHECK(keys == expected);
+    }
+
+    SECTION("stable_sort") {
+      auto expected = items;
+      std::stable_sort(expected.begin(), expected.end(), by_key);
+      ex::sync_wait(exec::stable_sort(pool.get_scheduler(), items, by_key));
+      CHECK(items == expected);
+    }
+  }
+
+  TEST_CASE("exec::sort uses the comparison", "[algorithms][sort]") {
+    exec::static_thread_pool pool{4};
+    auto keys = random_keys(300'000, 1000);
+    auto expected = keys;
+    std::sort(expected.begin(), expected.end(), std::greater{});
+
+    ex::sync_wait(exec::sort(pool.get_scheduler(), keys, std::greater{}));
+
+    CHECK(keys == expected);
+  }
+
+  TEST_CASE("exec::sort works with move-only elements", "[algorithms][sort]") {
+    exec::static_thread_pool pool{4};
+    auto keys = random_keys(100'000, 1'000'000);
+    std::vector<std::unique_ptr<int>> ptrs;
+    for (int key: keys) {
+      ptrs.push_back(std::make_unique<int>(key));
+    }
+    std::sort(keys.begin(), keys.end());
+
+    ex::sync_wait(exec::sort(
+      pool.get_scheduler(), ptrs, [](auto& a, auto& b) { return *a < *b; }));
+
+    REQUIRE(ptrs.size() == keys.size());
+    CHECK(std::equal(keys.begin(), keys.end(), ptrs.begin(), [](int k, auto& p) {
+      return k == *p;
+    }));
+  }
+
+  TEST_CASE("exec::stable_sort preserves the order of equal elements", "[algorithms][sort]") {
+    exec::static_thread_pool pool{4};
+    auto keys = random_keys(500'000, 100);
+    std::vector<std::pair<int, std::size_t>> items;
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+      items.emplace_back(keys[i], i);
+    }
+    auto expected = items;
+    auto by_key = [](auto const & a, auto const & b) { return a.first < b.first; };
+    std::stable_sort(expected.begin(), expected.end(), by_key);
+
+    ex::sync_wait(exec::stable_sort(pool.get_scheduler(), items, by_key));
+
+    CHECK(items == expected);
+  }
+
+  TEST_CASE("exec::sort propagates exceptions", "[algorithms][sort]") {
+    exec::static_thread_pool pool{4};
+    auto keys = random_keys(200'000, 1'000'000);
+    auto snd = exec::sort(pool.get_scheduler(), keys, [](int a, int b) {
+      if (a == b) {
+        throw std::runtime_error("sort");
+      }
+      return a < b;
+    });
+    CHECK_THROWS_AS(ex::sync_wait(std::move(snd)), std::runtime_error);
+  }
+
+  TEST_CASE("exec::partition partitions a range", "[algorithms][partition]") {
+    exec::static_thread_pool pool{4};
+    const std::size_t n = GENERATE(0u, 10u, 300'001u);
+    auto keys = random_keys(n, 1'000'000);
+    auto is_even = [](int key) { return key % 2 == 0; };
+    const auto num_even = std::count_if(keys.begin(), keys.end(), is_even);
+    auto sorted = keys;
+    std::sort(sorted.begin(), sorted.end());
+
+    auto [middle] = ex::sync_wait(exec::partition(pool.get_scheduler(), keys, is_even)).value();
+
+    CHECK(middle - keys.begin() == num_even);
+    CHECK(std::all_of(keys.begin(), middle, is_even));
+    CHECK(std::none_of(middle, keys.end(), is_even));
+    std::sort(keys.begin(), keys.end());
+    CHECK(keys == sorted);
+  }
+
+  TEST_CASE("exec::sort works with the inline scheduler", "[algorithms][sort]") {
+    auto keys = random_keys(100'000, 1'000'000);
+    auto expected = keys;
+    std::sort(expected.begin(), expected.end());
+
+    ex::sync_wait(exec::sort(exec::inline_scheduler{}, keys));
+
+    CHECK(keys == expected);
+  }
+} // namespace
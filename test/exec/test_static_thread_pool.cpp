@@ -20,3 +20,35 @@ TEST_CASE(
   }
   REQUIRE(thread_ids.size() == num_of_threads);
 }
+
+TEST_CASE(
+  "static_thread_pool sync_wait on a worker thread runs the pool's tasks",
+  "[types][static_thread_pool]") {
+  exec::static_thread_pool pool{1};
+  auto sch = pool.get_scheduler();
+
+  // The only worker blocks in sync_wait on work that can only run on that worker.
+  auto nested = ex::schedule(sch) | ex::then([sch] {
+                  auto [value] = ex::sync_wait(ex::schedule(sch) | ex::then([] { return 41; }))
+                                   .value();
+                  return value + 1;
+                });
+  auto [value] = ex::sync_wait(std::move(nested)).value();
+  REQUIRE(value == 42);
+}
+
+TEST_CASE(
+  "static_thread_pool nested sync_wait calls keep the pool busy",
+  "[types][static_thread_pool]") {
+  constexpr int num_tasks = 64;
+  exec::static_thread_pool pool{2};
+  auto sch = pool.get_scheduler();
+
+  std::atomic<int> count{0};
+  auto inner = [&] {
+    ex::sync_wait(ex::schedule(sch) | ex::then([&] { ++count; }));
+  };
+  auto outer = ex::schedule(sch) | ex::bulk(num_tasks, [&](int) { inner(); });
+  ex::sync_wait(std::move(outer));
+  REQUIRE(count.load() == num_tasks);
+}
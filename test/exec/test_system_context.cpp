@@ -17,18 +17,24 @@
 #include <thread>
 #include <iostream>
 #include <chrono>
+#include <vector>
+#include <algorithm>
+#include <atomic>
 
 #define STDEXEC_SYSTEM_CONTEXT_HEADER_ONLY 1
 
 #include <stdexec/execution.hpp>
 
 #include <exec/async_scope.hpp>
+#include <exec/bulk_chunked.hpp>
+#include <exec/deadline.hpp>
 #include <exec/inline_scheduler.hpp>
 #include <exec/static_thread_pool.hpp>
 #include <exec/system_context.hpp>
 
 #include <catch2/catch.hpp>
 #include <test_common/receivers.hpp>
+#include <test_common/system_context.hpp>
 
 
 namespace ex = stdexec;
@@ -165,6 +171,26 @@ TEST_CASE("simple bulk task on system context", "[types][system_scheduler]") {
   (void) bulk_snd;
 }
 
+TEST_CASE("bulk_chunked on system context", "[types][system_scheduler]") {
+  constexpr std::size_t num_items = 1000;
+  std::vector<int> counter(num_items, 0);
+  std::atomic<std::size_t> num_chunks{0};
+  exec::system_scheduler sched = exec::get_system_scheduler();
+
+  auto snd = exec::bulk_chunked(
+    ex::schedule(sched), num_items, [&](std::size_t begin, std::size_t end) {
+      ++num_chunks;
+      for (std::size_t i = begin; i < end; ++i) {
+        ++counter[i];
+      }
+    });
+  ex::sync_wait(std::move(snd));
+
+  // Assert: the chunks partition the whole range.
+  CHECK(std::count(counter.begin(), counter.end(), 1) == static_cast<int>(num_items));
+  CHECK(num_chunks <= std::max(std::thread::hardware_concurrency(), 1u));
+}
+
 TEST_CASE("simple bulk chaining on system context", "[types][system_scheduler]") {
   std::thread::id this_id = std::this_thread::get_id();
   constexpr size_t num_tasks = 16;
@@ -200,6 +226,86 @@ TEST_CASE("simple bulk chaining on system context", "[types][system_scheduler]")
   CHECK(std::get<0>(res.value()) == pool_id);
 }
 
+struct my_bulk_scheduler_impl : exec::__system_context_default_impl::__system_scheduler_impl {
+  using base_t = exec::__system_context_default_impl::__system_scheduler_impl;
+
+  void bulk_schedule(
+    uint32_t __n,
+    exec::__system_context_default_impl::storage __s,
+    exec::__system_context_default_impl::bulk_item_receiver* __r) noexcept override {
+    ++num_item_schedules;
+    base_t::bulk_schedule(__n, __s, __r);
+  }
+
+  void bulk_schedule_chunked(
+    uint32_t __n,
+    exec::__system_context_default_impl::storage __s,
+    exec::__system_context_default_impl::bulk_chunk_receiver* __r) noexcept override {
+    ++num_chunked_schedules;
+    base_t::bulk_schedule_chunked(__n, __s, __r);
+  }
+
+  int num_item_schedules = 0;
+  int num_chunked_schedules = 0;
+};
+
+TEST_CASE("bulk uses the chunked backend interface if available", "[types][system_scheduler]") {
+  using namespace exec::system_context_replaceability;
+  constexpr std::size_t num_items = 1000;
+  auto run_bulk = [] {
+    std::vector<std::atomic<int>> counter(num_items);
+    ex::sync_wait(ex::bulk(
+      ex::schedule(exec::get_system_scheduler()), num_items, [&](std::size_t i) { ++counter[i]; }));
+    return std::all_of(counter.begin(), counter.end(), [](auto& c) { return c == 1; });
+  };
+
+  auto* scr = query_system_context<__system_context_replaceability_v3>();
+  REQUIRE(scr != nullptr);
+
+  my_bulk_scheduler_impl my_scheduler;
+  system_backend_guard guard;
+  scr->__set_system_scheduler(static_cast<system_scheduler_v2*>(&my_scheduler));
+  CHECK(run_bulk());
+  CHECK(my_scheduler.num_chunked_schedules == 1);
+  CHECK(my_scheduler.num_item_schedules == 0);
+
+  // A backend set through version 1 of the interface gets one call per item.
+  scr->__set_system_scheduler(static_cast<system_scheduler*>(&my_scheduler));
+  CHECK(query_system_context<system_scheduler_v2>() == nullptr);
+  CHECK(run_bulk());
+  CHECK(my_scheduler.num_chunked_schedules == 1);
+  CHECK(my_scheduler.num_item_schedules == 1);
+}
+
+TEST_CASE("schedule_after on system context", "[types][system_scheduler]") {
+  using namespace std::chrono_literals;
+  exec::system_scheduler sched = exec::get_system_scheduler();
+  STATIC_REQUIRE(exec::timed_scheduler<exec::system_scheduler>);
+
+  std::thread::id this_id = std::this_thread::get_id();
+  std::thread::id pool_id{};
+  const auto start = exec::now(sched);
+  ex::sync_wait(ex::then(exec::schedule_after(sched, 10ms), [&] {
+    pool_id = std::this_thread::get_id();
+  }));
+  REQUIRE(exec::now(sched) - start >= 10ms);
+  REQUIRE(pool_id != std::thread::id{});
+  REQUIRE(this_id != pool_id);
+
+  const auto deadline = exec::now(sched) + 10ms;
+  ex::sync_wait(exec::schedule_at(sched, deadline));
+  REQUIRE(exec::now(sched) >= deadline);
+}
+
+TEST_CASE("timers on system context can be stopped", "[types][system_scheduler]") {
+  using namespace std::chrono_literals;
+  exec::system_scheduler sched = exec::get_system_scheduler();
+  const auto start = exec::now(sched);
+  auto result = ex::sync_wait(exec::with_timeout(exec::schedule_after(sched, 1h), sched, 10ms));
+  REQUIRE_FALSE(result.has_value());
+  REQUIRE(exec::now(sched) - start < 1min);
+}
+
 struct my_system_scheduler_impl : exec::__system_context_default_impl::__system_scheduler_impl {
   using base_t = exec::__system_context_default_impl::__system_scheduler_impl;
 
@@ -226,6 +332,7 @@ TEST_CASE("can change the implementation of system context", "[types][system_sch
 
   // Not to spec.
   my_system_scheduler_impl my_scheduler;
+  system_backend_guard guard;
   auto scr = query_system_context<__system_context_replaceability>();
   scr->__set_system_scheduler(&my_scheduler);
 
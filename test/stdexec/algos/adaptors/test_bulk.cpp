@@ -339,6 +339,79 @@ namespace {
     }
   }
 
+  TEST_CASE("adjacent bulk stages are fused on static thread pool", "[adaptors][bulk]") {
+    exec::static_thread_pool pool{4};
+    ex::scheduler auto sch = pool.get_scheduler();
+    constexpr std::size_t n = 1000;
+
+    SECTION("Eager customization") {
+      std::vector<std::size_t> a(n, 0);
+      std::vector<std::size_t> b(n, 0);
+      std::vector<std::size_t> c(n, 0);
+
+      auto snd = ex::transfer_just(sch)
+               | ex::bulk(n, [&](std::size_t i) { a[i] = i; })
+               | ex::bulk(n, [&](std::size_t i) { b[i] = a[(i + 1) % n] + a[(n + i - 1) % n]; })
+               | ex::bulk(n, [&](std::size_t i) { c[i] = b[(i + n / 2) % n]; });
+      STATIC_REQUIRE(std::tuple_size_v<decltype(snd.shapes_)> == 3);
+      stdexec::sync_wait(std::move(snd));
+
+      // Every stage must observe all the writes of the previous one.
+      for (std::size_t i = 0; i < n; ++i) {
+        const std::size_t j = (i + n / 2) % n;
+        CHECK(c[i] == (j + 1) % n + (n + j - 1) % n);
+      }
+    }
+
+    SECTION("Lazy customization") {
+      std::vector<std::size_t> a(n, 0);
+      std::vector<std::size_t> b(n, 0);
+
+      auto snd = ex::just(std::size_t{2})
+               | ex::bulk(n, [&](std::size_t i, std::size_t k) { a[i] = k * i; })
+               | ex::bulk(n, [&](std::size_t i, std::size_t) { b[i] = a[n - i - 1]; });
+      auto [k] = stdexec::sync_wait(stdexec::starts_on(sch, std::move(snd))).value();
+
+      CHECK(k == 2);
+      for (std::size_t i = 0; i < n; ++i) {
+        CHECK(b[i] == 2 * (n - i - 1));
+      }
+    }
+
+    SECTION("Values are forwarded to the next adaptor") {
+      auto snd = ex::transfer_just(sch, 3)
+               | ex::bulk(n, [](std::size_t, int&) { })
+               | ex::bulk(n, [](std::size_t, int&) { })
+               | ex::then([](int&& k) noexcept { return k + 1; });
+      auto [k] = stdexec::sync_wait(std::move(snd)).value();
+
+      CHECK(k == 4);
+    }
+
+    SECTION("With different shapes") {
+      std::vector<int> counter_1(3, 0);
+      std::vector<int> counter_2(n, 0);
+
+      auto snd = ex::transfer_just(sch)
+               | ex::bulk(counter_1.size(), [&](std::size_t i) { counter_1[i]++; })
+               | ex::bulk(counter_2.size(), [&](std::size_t i) { counter_2[i]++; });
+      stdexec::sync_wait(std::move(snd));
+
+      CHECK(std::count(counter_1.begin(), counter_1.end(), 1) == 3);
+      CHECK(std::count(counter_2.begin(), counter_2.end(), 1) == static_cast<int>(n));
+    }
+
+    SECTION("With exception in the first stage") {
+      std::atomic<int> called{0};
+      auto snd = ex::transfer_just(sch)
+               | ex::bulk(9, [](int) { throw std::runtime_error("bulk"); })
+               | ex::bulk(9, [&](int) { called++; });
+
+      CHECK_THROWS_AS(stdexec::sync_wait(std::move(snd)), std::runtime_error);
+      CHECK(called == 0);
+    }
+  }
+
   TEST_CASE("default bulk works with non-default constructible types", "[adaptors][bulk]") {
     ex::sender auto s = ex::just(non_default_constructible{42}) | ex::bulk(1, [](int, auto&) { });
     ex::sync_wait(std::move(s));
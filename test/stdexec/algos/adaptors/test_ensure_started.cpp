@@ -23,6 +23,7 @@
 #include <test_common/schedulers.hpp>
 #include <test_common/receivers.hpp>
 #include <test_common/type_helpers.hpp>
+#include <test_common/allocators.hpp>
 
 namespace ex = stdexec;
 using exec::async_scope;
@@ -339,4 +340,22 @@ namespace {
     (void) snd1;
     (void) snd2;
   }
+
+  // NOT TO SPEC
+  TEST_CASE(
+    "ensure_started allocates its shared state with the env's allocator",
+    "[adaptors][ensure_started]") {
+    allocation_counts counts;
+    impulse_scheduler sch;
+    {
+      auto env = ex::prop{ex::get_allocator, counting_allocator<std::byte>{counts}};
+      auto snd = ex::ensure_started(ex::starts_on(sch, ex::just(42)), env);
+      CHECK(counts.allocated == 1);
+      sch.start_next();
+      auto [v] = ex::sync_wait(std::move(snd)).value();
+      CHECK(v == 42);
+    }
+    CHECK(counts.allocated == 1);
+    CHECK(counts.alive == 0);
+  }
 } // namespace
@@ -21,6 +21,7 @@
 #include <test_common/senders.hpp>
 #include <test_common/receivers.hpp>
 #include <test_common/type_helpers.hpp>
+#include <test_common/allocators.hpp>
 #include <exec/env.hpp>
 #include <exec/static_thread_pool.hpp>
 
@@ -532,4 +533,20 @@ namespace {
     (void) snd1;
     (void) snd2;
   }
+
+  // NOT TO SPEC
+  TEST_CASE("split allocates its shared state with the env's allocator", "[adaptors][split]") {
+    allocation_counts counts;
+    {
+      auto env = ex::prop{ex::get_allocator, counting_allocator<std::byte>{counts}};
+      auto snd = ex::split(ex::just(42), env);
+      CHECK(counts.allocated == 1);
+      auto [v1] = ex::sync_wait(snd).value();
+      auto [v2] = ex::sync_wait(snd).value();
+      CHECK(v1 == 42);
+      CHECK(v2 == 42);
+    }
+    CHECK(counts.allocated == 1);
+    CHECK(counts.alive == 0);
+  }
 } // namespace
@@ -23,8 +23,11 @@
 #include <test_common/type_helpers.hpp>
 #include <exec/static_thread_pool.hpp>
 
-#include <thread>
 #include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <utility>
 
 namespace ex = stdexec;
 using std::optional;
@@ -34,7 +37,27 @@ using stdexec::sync_wait_with_variant;
 
 using namespace std::chrono_literals;
 
+namespace stdexec::__loop {
+  struct __test_access {
+    static auto is_ready(const run_loop& loop) -> bool {
+      return loop.__ready_.load();
+    }
+
+    static auto sleepers(run_loop& loop) -> std::size_t {
+      std::lock_guard lock{loop.__mutex_};
+      return loop.__sleepers_;
+    }
+
+    static auto spin_budget() -> std::size_t& {
+      return run_loop::__spin_budget_();
+    }
+
+    static constexpr std::size_t min_spin_budget = run_loop::__min_spin_budget_;
+  };
+} // namespace stdexec::__loop
+
 namespace {
+  using run_loop_access = ex::__loop::__test_access;
 
   TEST_CASE("sync_wait simple test", "[consumers][sync_wait]") {
     optional<tuple<int>> res = sync_wait(ex::just(49));
@@ -180,6 +203,119 @@ namespace {
     CHECK(thread_stopped.load());
   }
 
+  TEST_CASE(
+    "sync_wait works for completions that arrive before or after it parks",
+    "[consumers][sync_wait]") {
+    exec::static_thread_pool pool{1};
+    ex::scheduler auto sched = pool.get_scheduler();
+
+    // Quick completions are picked up while sync_wait is still spinning...
+    for (int i = 0; i < 1000; ++i) {
+      auto res = sync_wait(ex::transfer_just(sched, i));
+      REQUIRE(res.has_value());
+      CHECK(std::get<0>(res.value()) == i);
+    }
+
+    // ... and slow ones after it has parked on the condition variable.
+    auto res = sync_wait(ex::schedule(sched) | ex::then([] {
+                           std::this_thread::sleep_for(20ms);
+                           return 42;
+                         }));
+    REQUIRE(res.has_value());
+    CHECK(std::get<0>(res.value()) == 42);
+  }
+
+  TEST_CASE(
+    "run_loop publishes work to spinning waiters without notifying",
+    "[consumers][sync_wait]") {
+    ex::run_loop loop;
+    int count = 0;
+    std::thread producer{[&] {
+      ex::start_detached(ex::schedule(loop.get_scheduler()) | ex::then([&] { ++count; }));
+      ex::start_detached(ex::schedule(loop.get_scheduler()) | ex::then([&] { loop.finish(); }));
+    }};
+    producer.join();
+    // Nobody was parked, so the producer skipped the notification; a spinning waiter sees
+    // the work through the ready flag.
+    CHECK(run_loop_access::sleepers(loop) == 0);
+    CHECK(run_loop_access::is_ready(loop));
+    loop.run();
+    CHECK(count == 1);
+    CHECK(run_loop_access::is_ready(loop));
+  }
+
+  TEST_CASE(
+    "sync_wait on a pool thread runs work that continues on its own loop",
+    "[consumers][sync_wait]") {
+    // The nested sync_wait helps the pool while it waits, and must still run the continuation
+    // that comes back to its run_loop from another thread.
+    exec::static_thread_pool pool{1};
+    exec::static_thread_pool other{1};
+    auto res = sync_wait(ex::schedule(pool.get_scheduler()) | ex::then([&] {
+                           auto inner = ex::read_env(ex::get_delegation_scheduler)
+                                      | ex::let_value([&](auto sched) {
+                                          return ex::starts_on(
+                                                   other.get_scheduler(),
+                                                   ex::just() | ex::then([] {
+                                                     std::this_thread::sleep_for(20ms);
+                                                     return 42;
+                                                   }))
+                                               | ex::continues_on(sched);
+                                        });
+                           return std::get<0>(sync_wait(std::move(inner)).value());
+                         }));
+    REQUIRE(res.has_value());
+    CHECK(std::get<0>(res.value()) == 42);
+  }
+
+  TEST_CASE("run_loop spins before it parks", "[consumers][sync_wait]") {
+    // The budget stays the same when spinning finds work, and halves when the thread parks.
+    const std::size_t saved_budget = std::exchange(
+      run_loop_access::spin_budget(), 4 * run_loop_access::min_spin_budget);
+
+    SECTION("Work that is already there is found by spinning") {
+      ex::run_loop loop;
+      std::thread{[&] {
+        ex::start_detached(ex::schedule(loop.get_scheduler()) | ex::then([&] { loop.finish(); }));
+      }}.join();
+      loop.run();
+      CHECK(run_loop_access::spin_budget() == 4 * run_loop_access::min_spin_budget);
+    }
+
+    SECTION("Late work is found after parking") {
+      ex::run_loop loop;
+      std::thread producer{[&] {
+        std::this_thread::sleep_for(20ms);
+        ex::start_detached(ex::schedule(loop.get_scheduler()) | ex::then([&] { loop.finish(); }));
+      }};
+      loop.run();
+      producer.join();
+      CHECK(run_loop_access::spin_budget() == 2 * run_loop_access::min_spin_budget);
+    }
+
+    run_loop_access::spin_budget() = saved_budget;
+  }
+
+  TEST_CASE("run_loop can be driven by several threads", "[consumers][sync_wait]") {
+    ex::run_loop loop;
+    std::atomic<int> count{0};
+    auto drive = [&] {
+      loop.run();
+    };
+    std::thread t1{drive};
+    std::thread t2{drive};
+    for (int i = 0; i < 1000; ++i) {
+      ex::start_detached(ex::schedule(loop.get_scheduler()) | ex::then([&] { ++count; }));
+    }
+    while (count.load() != 1000) {
+      std::this_thread::yield();
+    }
+    loop.finish();
+    t1.join();
+    t2.join();
+    CHECK(count.load() == 1000);
+  }
+
   TEST_CASE(
     "sync_wait can wait on operations happening on different threads",
     "[consumers][sync_wait]") {
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace {
+
+  struct allocation_counts {
+    std::atomic<std::size_t> allocated{0};
+    std::atomic<std::size_t> alive{0};
+  };
+
+  //! An allocator that counts the allocations made through it and its rebound copies.
+  template <class T>
+  struct counting_allocator {
+    using value_type = T;
+
+    explicit counting_allocator(allocation_counts& counts) noexcept
+      : counts_(&counts) {
+    }
+
+    template <class U>
+    counting_allocator(const counting_allocator<U>& other) noexcept
+      : counts_(other.counts_) {
+    }
+
+    auto allocate(std::size_t n) -> T* {
+      counts_->allocated.fetch_add(1);
+      counts_->alive.fetch_add(1);
+      return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept {
+      counts_->alive.fetch_sub(1);
+      std::allocator<T>().deallocate(p, n);
+    }
+
+    template <class U>
+    auto operator==(const counting_allocator<U>& other) const noexcept -> bool {
+      return counts_ == other.counts_;
+    }
+
+    allocation_counts* counts_;
+  };
+} // namespace
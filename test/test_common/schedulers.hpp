@@ -255,6 +255,11 @@ namespace {
       R recv_;
       E err_;
 
+      oper(R recv, E err)
+        : recv_(static_cast<R&&>(recv))
+        , err_(static_cast<E&&>(err)) {
+      }
+
       friend void tag_invoke(ex::start_t, oper& self) noexcept {
         ex::set_error(static_cast<R&&>(self.recv_), static_cast<E&&>(self.err_));
       }
@@ -274,7 +279,7 @@ namespace {
 
       template <class R>
       friend oper<R> tag_invoke(ex::connect_t, my_sender self, R&& r) {
-        return {{}, static_cast<R&&>(r), static_cast<E&&>(self.err_)};
+        return {static_cast<R&&>(r), static_cast<E&&>(self.err_)};
       }
 
       scheduler_env<error_scheduler> get_env() const noexcept {
@@ -301,6 +306,10 @@ namespace {
     struct oper : immovable {
       R recv_;
 
+      explicit oper(R recv)
+        : recv_(static_cast<R&&>(recv)) {
+      }
+
       void start() & noexcept {
         ex::set_stopped(static_cast<R&&>(recv_));
       }
@@ -317,7 +326,7 @@ namespace {
 
       template <class R>
       oper<R> connect(R r) const {
-        return {{}, static_cast<R&&>(r)};
+        return oper<R>{static_cast<R&&>(r)};
       }
 
       scheduler_env<stopped_scheduler> get_env() const noexcept {
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <exec/system_context.hpp>
+
+namespace {
+
+  // Saves the current backend of the system context and restores it on destruction, through
+  // the newest version of the interface that the backend was set with. Tests that replace the
+  // backend use it so that they do not depend on, or leak into, the tests that run before or
+  // after them.
+  class system_backend_guard {
+    using system_scheduler_v1 = exec::system_context_replaceability::system_scheduler;
+    using system_scheduler_v2 = exec::system_context_replaceability::system_scheduler_v2;
+    using system_scheduler_v3 = exec::system_context_replaceability::system_scheduler_v3;
+    using replaceability_v3 =
+      exec::system_context_replaceability::__system_context_replaceability_v3;
+
+    template <class Interface>
+    static auto query() -> Interface* {
+      return exec::system_context_replaceability::query_system_context<Interface>();
+    }
+
+    system_scheduler_v1* v1_ = query<system_scheduler_v1>();
+    system_scheduler_v2* v2_ = query<system_scheduler_v2>();
+    system_scheduler_v3* v3_ = query<system_scheduler_v3>();
+
+   public:
+    system_backend_guard() = default;
+    system_backend_guard(system_backend_guard&&) = delete;
+
+    ~system_backend_guard() {
+      auto* scr = query<replaceability_v3>();
+      if (v3_ != nullptr) {
+        scr->__set_system_scheduler(v3_);
+      } else if (v2_ != nullptr) {
+        scr->__set_system_scheduler(v2_);
+      } else {
+        scr->__set_system_scheduler(v1_);
+      }
+    }
+  };
+} // namespace